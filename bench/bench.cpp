@@ -0,0 +1,255 @@
+#include <jessy/jessy.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+
+	struct quote {
+		double bid;
+		double ask;
+		double last;
+		double balance;
+		std::int64_t login;
+	};
+	
+	
+} // namespace
+
+
+template<>
+struct jessy::binding<quote> {
+	static constexpr auto fields = std::make_tuple(
+		jessy::field("login", &quote::login),
+		jessy::field("balance", &quote::balance),
+		jessy::field("last", &quote::last),
+		jessy::field("ask", &quote::ask),
+		jessy::field("bid", &quote::bid));
+};
+
+
+namespace {
+
+
+	template<typename F>
+	void measure(char const* name, std::size_t items, std::size_t bytes, F&& f) {
+		using clock = std::chrono::steady_clock;
+		constexpr auto rounds = 20;
+		auto best = clock::duration::max();
+		for(auto i = 0; i != rounds; ++i) {
+			auto const started = clock::now();
+			f();
+			auto const elapsed = clock::now() - started;
+			if(elapsed < best)
+				best = elapsed;
+		}
+		auto const ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(best).count());
+		std::printf("%-32s %8.2f ns/item %8.2f MB/s\n",
+		            name, ns / double(items), double(bytes) * 1e3 / ns);
+	}
+	
+	
+	std::vector<std::string> make_prices(std::size_t n) {
+		auto random = std::mt19937_64{42};
+		auto prices = std::vector<std::string>{};
+		prices.reserve(n);
+		for(auto i = std::size_t(0); i != n; ++i) {
+			auto const cents = random() % 10000000;
+			auto const digits = 1 + random() % 6;
+			auto price = std::to_string(cents);
+			if(price.size() <= digits)
+				price.insert(0, digits - price.size() + 1, '0');
+			price.insert(price.size() - digits, 1, '.');
+			prices.push_back(std::move(price));
+		}
+		return prices;
+	}
+	
+	
+	std::string make_document(std::vector<std::string> const& prices) {
+		auto text = std::string{"["};
+		for(auto i = std::size_t(0); i + 4 <= prices.size(); i += 4) {
+			if(i != 0)
+				text += ",\n";
+			text += "{\"bid\": " + prices[i] + ", \"ask\": " + prices[i + 1]
+				+ ", \"last\": " + prices[i + 2] + ", \"balance\": " + prices[i + 3]
+				+ ", \"login\": " + std::to_string(30436013 + i) + "}";
+		}
+		text += "]";
+		return text;
+	}
+	
+	
+	std::string make_pretty_document(std::string const& compact) {
+		auto text = std::string{};
+		for(auto const c: compact) {
+			text += c;
+			if(c == '{' || c == ',')
+				text += "\n        ";
+		}
+		return text;
+	}
+	
+	
+	double sum_prices(jessy::parser const& parser) {
+		auto sum = 0.0;
+		auto const quotes = *parser.root()->as_array();
+		for(auto const& each: quotes) {
+			auto const quote = *each.as_object();
+			for(auto const& field: quote)
+				if(field.is_float())
+					sum += *field.as_double();
+		}
+		return sum;
+	}
+	
+	
+	volatile double sink;
+	
+	
+} // namespace
+
+
+int main() {
+	static char const* const levels[] = {"scalar", "SSE2", "SSE4.2", "AVX2", "AVX-512"};
+	std::printf("kernels: %s\n", levels[int(jessy::detail::detect_simd_level())]);
+	
+	auto const prices = make_prices(100000);
+	auto price_bytes = std::size_t(0);
+	for(auto const& price: prices)
+		price_bytes += price.size();
+	
+	measure("std::from_chars(double)", prices.size(), price_bytes, [&] {
+		auto sum = 0.0;
+		for(auto const& price: prices) {
+			auto value = 0.0;
+			std::from_chars(price.data(), price.data() + price.size(), value);
+			sum += value;
+		}
+		sink = sum;
+	});
+	
+	measure("jessy::detail::parse_double", prices.size(), price_bytes, [&] {
+		auto sum = 0.0;
+		for(auto const& price: prices) {
+			auto value = 0.0;
+			jessy::detail::parse_double(price.data(), price.data() + price.size(), value);
+			sum += value;
+		}
+		sink = sum;
+	});
+	
+	auto const document = make_document(prices);
+	auto lazy = jessy::parser{};
+	measure("parse + as_double", prices.size(), document.size(), [&] {
+		lazy.parse(document);
+		sink = sum_prices(lazy);
+	});
+	
+	auto opts = jessy::options{};
+	opts.decode_numbers = true;
+	auto eager = jessy::parser{opts};
+	measure("parse(decode_numbers) + as_double", prices.size(), document.size(), [&] {
+		eager.parse(document);
+		sink = sum_prices(eager);
+	});
+	
+	lazy.parse(document);
+	measure("sum values", prices.size(), document.size(), [&] {
+		sink = sum_prices(lazy);
+	});
+	
+	auto compact = jessy::compact_document{};
+	measure("parse(compact_document)", prices.size() / 4, document.size(), [&] {
+		sink = double(lazy.parse(document, compact));
+	});
+	
+	measure("sum compact values", prices.size(), document.size(), [&] {
+		auto sum = 0.0;
+		auto const quotes = *compact.root().as_array();
+		for(auto const each: quotes) {
+			auto const quote = *each.as_object();
+			for(auto it = quote.begin(); it != quote.end(); ++it)
+				if((*it).is_float())
+					sum += *(*it).as_double();
+		}
+		sink = sum;
+	});
+	
+	auto validator = jessy::parser{};
+	measure("validate", prices.size() / 4, document.size(), [&] {
+		sink = double(validator.validate(document));
+	});
+	
+	measure("parse", prices.size() / 4, document.size(), [&] {
+		sink = double(lazy.parse(document));
+	});
+	
+	auto const pretty = make_pretty_document(document);
+	measure("parse(pretty)", prices.size() / 4, pretty.size(), [&] {
+		sink = double(lazy.parse(pretty));
+	});
+	
+	auto const bids = jessy::projection{"/bid"};
+	auto projected = jessy::parser{};
+	measure("parse(projection{\"/bid\"})", prices.size() / 4, document.size(), [&] {
+		projected.parse(document, bids);
+		sink = double(projected.root()->as_array()->size());
+	});
+	
+	measure("jessy::read<quote>", prices.size() / 4, document.size(), [&] {
+		auto sum = 0.0;
+		auto const quotes = *lazy.root()->as_array();
+		for(auto const& each: quotes) {
+			auto q = quote{};
+			jessy::read(each, q);
+			sum += q.bid + q.ask + q.last + q.balance + double(q.login);
+		}
+		sink = sum;
+	});
+	
+	measure("object::find per field", prices.size() / 4, document.size(), [&] {
+		auto sum = 0.0;
+		auto const quotes = *lazy.root()->as_array();
+		for(auto const& each: quotes) {
+			auto const object = *each.as_object();
+			auto q = quote{};
+			q.login = *object.find(object.begin(), "login")->as_int();
+			q.balance = *object.find(object.begin(), "balance")->as_double();
+			q.last = *object.find(object.begin(), "last")->as_double();
+			q.ask = *object.find(object.begin(), "ask")->as_double();
+			q.bid = *object.find(object.begin(), "bid")->as_double();
+			sum += q.bid + q.ask + q.last + q.balance + double(q.login);
+		}
+		sink = sum;
+	});
+	
+	measure("parse + jessy::read<quote>", prices.size() / 4, document.size(), [&] {
+		lazy.parse(document);
+		auto sum = 0.0;
+		auto const quotes = *lazy.root()->as_array();
+		for(auto const& each: quotes) {
+			auto q = quote{};
+			jessy::read(each, q);
+			sum += q.bid + q.ask + q.last + q.balance + double(q.login);
+		}
+		sink = sum;
+	});
+	
+	auto direct = jessy::parser{};
+	auto quotes = std::vector<quote>{};
+	measure("parse_into<std::vector<quote>>", prices.size() / 4, document.size(), [&] {
+		direct.parse_into(document, quotes);
+		auto sum = 0.0;
+		for(auto const& q: quotes)
+			sum += q.bid + q.ask + q.last + q.balance + double(q.login);
+		sink = sum;
+	});
+	
+	return 0;
+}
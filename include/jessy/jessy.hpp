@@ -5,12 +5,50 @@
 #pragma once
 
 
+#include <cfloat>
 #include <charconv>
 #include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__has_include)
+#	if __has_include(<memory_resource>)
+#		include <memory_resource>
+#	endif
+#endif
+
+
+// JESSY_PMR is 1 when std::pmr is usable, storage then may be taken from memory_resource
+#if !defined(JESSY_PMR)
+#	if defined(__cpp_lib_memory_resource)
+#		define JESSY_PMR 1
+#	else
+#		define JESSY_PMR 0
+#	endif
+#endif
+
+
+// JESSY_SIMD_LEVEL caps detected kernels: 0 scalar, 1 SSE2, 2 SSE4.2, 3 AVX2, 4 AVX-512
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#	define JESSY_X86 1
+#	include <immintrin.h>
+#	if defined(_MSC_VER) && !defined(__clang__)
+#		include <intrin.h>
+#		define JESSY_TARGET(isa)
+#	else
+#		define JESSY_TARGET(isa) __attribute__((target(isa)))
+#	endif
+#endif
+
 
 namespace jessy {
 
@@ -40,54 +78,96 @@ namespace jessy {
 	}
 	
 	
+	enum class rounding: std::uint8_t {
+		exact, toward_zero, half_away_from_zero, half_even
+	}; // rounding
+	
+	
 	class value_tag {
-		std::size_t tag_{0u};
-		
 	public:
 	
 		using size_type = std::size_t;
 		
+	private:
+	
+		static constexpr unsigned type_shift = sizeof(size_type) * 8 - 8;
+		static constexpr unsigned flags_shift = type_shift + 3;
+		static constexpr unsigned aux_shift = sizeof(size_type) == 8 ? 32 : 24;
+		static constexpr size_type type_mask = 0x07;
+		static constexpr size_type length_mask = (size_type(1) << aux_shift) - 1;
+		static constexpr size_type aux_mask = (size_type(1) << type_shift) - 1 - length_mask;
+	
+		size_type tag_{0u};
+		
+	public:
+		
 		constexpr value_tag() = default;
 		constexpr value_tag(value_tag const&) = default;
 		constexpr value_tag& operator = (value_tag const&) = default;
 		
-		constexpr value_tag(value_type type) noexcept {
-			if constexpr(sizeof(size_type) == 4)
-				tag_ = size_type(type) << 24;
-			else
-				tag_ = size_type(type) << 56;
-		}
+		constexpr value_tag(value_type type) noexcept
+		: tag_{size_type(type) << type_shift} { }
 		
 		
-		constexpr value_tag(value_type type, size_type length) noexcept {
-			if constexpr(sizeof(size_type) == 4)
-				tag_ = (size_type(type) << 24) | (length & 0x00FFFFFF);
-			else
-				tag_ = (size_type(type) << 56) | (length & 0x00FFFFFFFFFFFFFF);
-		}
+		constexpr value_tag(value_type type, size_type length) noexcept
+		: tag_{(size_type(type) << type_shift) | (length & length_mask)} { }
 		
 		
 		constexpr value_type type() const noexcept {
-			if constexpr(sizeof(size_type) == 4)
-				return value_type(tag_ >> 24);
-			else
-				return value_type(tag_ >> 56);
+			return value_type((tag_ >> type_shift) & type_mask);
 		}
 		
 		
 		constexpr size_type length() const noexcept {
-			if constexpr(sizeof(size_type) == 4)
-				return tag_ & 0x00FFFFFF;
-			else
-				return tag_ & 0x00FFFFFFFFFFFFFF;
+			return tag_ & length_mask;
 		}
 		
 		
 		constexpr void length(size_type n) noexcept {
-			if constexpr(sizeof(size_type) == 4)
-				tag_ |= (n & 0x00FFFFFF);
-			else
-				tag_ |= (n & 0x00FFFFFFFFFFFFFF);
+			tag_ = (tag_ & ~length_mask) | (n & length_mask);
+		}
+		
+		
+		constexpr size_type flags() const noexcept {
+			return tag_ >> flags_shift;
+		}
+		
+		
+		constexpr void flags(size_type f) noexcept {
+			tag_ = (tag_ & ~(~size_type(0) << flags_shift)) | (f << flags_shift);
+		}
+		
+		
+		// auxiliary bits between type and length, available on 64-bit targets only
+		static constexpr size_type aux_bits = sizeof(size_type) == 8 ? 24 : 0;
+		
+		// longest string or number text and most members of container, parser gives length_exceeded beyond
+		static constexpr size_type max_length = length_mask;
+		
+		
+		constexpr size_type aux() const noexcept {
+			return (tag_ & aux_mask) >> aux_shift;
+		}
+		
+		
+		constexpr void aux(size_type a) noexcept {
+			tag_ = (tag_ & ~aux_mask) | ((a << aux_shift) & aux_mask);
+		}
+		
+		
+		// length and auxiliary bits to be compared at once
+		constexpr size_type payload() const noexcept {
+			return tag_ & (aux_mask | length_mask);
+		}
+		
+		
+		constexpr void payload(size_type p) noexcept {
+			tag_ = (tag_ & ~(aux_mask | length_mask)) | (p & (aux_mask | length_mask));
+		}
+		
+		
+		static constexpr size_type payload(size_type length, size_type aux) noexcept {
+			return (length & length_mask) | ((aux << aux_shift) & aux_mask);
 		}
 		
 	}; // value_tag
@@ -98,6 +178,9 @@ namespace jessy {
 		bool boolean;
 		char const* text;
 		value_tag::size_type count;
+		std::int64_t integer;
+		std::uint64_t uinteger;
+		double real;
 		
 		constexpr value_data() noexcept: count{0} { }
 		constexpr value_data(bool value) noexcept: boolean{value} { }
@@ -105,15 +188,865 @@ namespace jessy {
 	}; // value_data
 	
 	
+	namespace detail {
+	
+	
+		// containers of parser and document, allocator is std::allocator without std::pmr
+#if JESSY_PMR
+		using string = std::pmr::string;
+		template<typename T> using vector = std::pmr::vector<T>;
+#else
+		using string = std::string;
+		template<typename T> using vector = std::vector<T>;
+#endif
+		
+		
+		inline std::uint64_t load_le64(char const* p) noexcept {
+			auto word = std::uint64_t(0);
+			std::memcpy(&word, p, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			word = __builtin_bswap64(word);
+#endif
+			return word;
+		}
+		
+		
+		constexpr std::uint64_t load_partial_le64(char const* p, std::size_t n) noexcept {
+			auto word = std::uint64_t(0);
+			for(auto i = std::size_t(0); i != n; ++i)
+				word |= std::uint64_t(std::uint8_t(p[i])) << (i * 8);
+			return word;
+		}
+		
+		
+		constexpr std::uint64_t rotate_left(std::uint64_t word, unsigned n) noexcept {
+			return (word << n) | (word >> (64 - n));
+		}
+
+
+		// mixes every eight bytes and length, so keys differing only in the middle differ too
+		constexpr std::uint32_t key_hash(std::string_view key) noexcept {
+			constexpr auto multiplier = std::uint64_t(0x9E3779B97F4A7C15);
+			auto const n = key.size();
+			auto h = std::uint64_t(n) << 56;
+			auto i = std::size_t(0);
+			for(; i + 8 <= n; i += 8)
+				h = rotate_left(h ^ (load_partial_le64(key.data() + i, 8) * multiplier), 27) * 5 + 0x52DCE729;
+			if(i != n)
+				h ^= load_partial_le64(key.data() + i, n - i) * multiplier;
+			h *= 0xFF51AFD7ED558CCD;
+			h ^= h >> 33;
+			h *= 0xC4CEB9FE1A85EC53;
+			h ^= h >> 33;
+			return std::uint32_t(h);
+		}
+		
+		
+		inline constexpr std::uint32_t key_signature_mask = 0xFFFFFF;
+		
+		
+		// table of key indices addressed by multiply-shift of key signatures
+		template<std::size_t N>
+		struct perfect_hash {
+			static constexpr std::size_t capacity = [] {
+				auto n = std::size_t(1);
+				while(n < N)
+					n *= 2;
+				return n * 16;
+			}();
+			
+			bool found{false};
+			std::uint32_t multiplier{0};
+			unsigned shift{0};
+			std::uint16_t slots[capacity]{};
+			value_tag::size_type payloads[N]{};
+			
+			constexpr std::size_t slot_of(std::uint32_t signature) const noexcept {
+				return std::uint32_t(signature * multiplier) >> shift;
+			}
+		}; // perfect_hash
+		
+		
+		// multiply-shift hash, odd multipliers are tried for each table size from 2 to 16 slots per key
+		template<std::size_t N>
+		constexpr perfect_hash<N> make_perfect_hash(std::string_view const (&keys)[N]) noexcept {
+			static_assert(N < 0xFFFF, "Too many keys");
+			constexpr auto attempts = 256;
+			auto hash = perfect_hash<N>{};
+			std::uint32_t signatures[N]{};
+			for(auto i = std::size_t(0); i != N; ++i) {
+				signatures[i] = key_hash(keys[i]) & key_signature_mask;
+				hash.payloads[i] = value_tag::payload(keys[i].size(), key_hash(keys[i]));
+			}
+			for(auto size = perfect_hash<N>::capacity / 8; size <= perfect_hash<N>::capacity; size *= 2) {
+				auto bits = 0u;
+				while((std::size_t(1) << bits) < size)
+					++bits;
+				hash.shift = 32 - bits;
+				hash.multiplier = 0x9E3779B1;
+				for(auto attempt = 0; attempt != attempts; ++attempt, hash.multiplier += 0x6A09E668) {
+					std::uint64_t used[perfect_hash<N>::capacity / 64 + 1]{};
+					auto collided = false;
+					for(auto i = std::size_t(0); i != N && !collided; ++i) {
+						auto const slot = hash.slot_of(signatures[i]);
+						auto const bit = std::uint64_t(1) << (slot & 63);
+						collided = (used[slot >> 6] & bit) != 0;
+						used[slot >> 6] |= bit;
+					}
+					if(collided)
+						continue;
+					hash.found = true;
+					for(auto i = std::size_t(0); i != N; ++i)
+						hash.slots[hash.slot_of(signatures[i])] = std::uint16_t(i + 1);
+					return hash;
+				}
+			}
+			return hash;
+		}
+		
+		
+		inline std::uint64_t parse_eight_digits(char const* p) noexcept {
+			constexpr auto mask = std::uint64_t(0x000000FF000000FF);
+			constexpr auto mul1 = std::uint64_t(100 + (1000000ull << 32));
+			constexpr auto mul2 = std::uint64_t(1 + (10000ull << 32));
+			auto word = load_le64(p) - 0x3030303030303030;
+			word = word * 10 + (word >> 8);
+			return (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+		}
+		
+		
+		// [first, last) should be JSON digits, returns false on overflow
+		inline bool parse_digits(char const* first,
+		                         char const* last,
+		                         std::uint64_t& magnitude) noexcept {
+			constexpr auto max_digits = 20;
+			auto const n = last - first;
+			if(n > max_digits)
+				return false;
+			auto const* digits_end = n == max_digits ? last - 1 : last;
+			auto m = std::uint64_t(0);
+			while(digits_end - first >= 8) {
+				m = m * 100000000 + parse_eight_digits(first);
+				first += 8;
+			}
+			while(first != digits_end)
+				m = m * 10 + std::uint64_t(*first++ - '0');
+			if(n == max_digits) {
+				constexpr auto limit = std::uint64_t(UINT64_MAX / 10);
+				auto const last_digit = std::uint64_t(*first - '0');
+				if(m > limit || (m == limit && last_digit > UINT64_MAX % 10))
+					return false;
+				m = m * 10 + last_digit;
+			}
+			magnitude = m;
+			return true;
+		}
+		
+		
+		// [first, last) should be a JSON number, result is the number scaled by 10^scale
+		inline bool parse_decimal(char const* first,
+		                          char const* last,
+		                          unsigned scale,
+		                          rounding mode,
+		                          std::int64_t& result) noexcept {
+			constexpr auto exponent_limit = std::int64_t(0x10000);
+			auto const* p = first;
+			auto const negative = *p == '-';
+			p += negative;
+			auto const* integral = p;
+			while(p != last && unsigned(*p - '0') < 10)
+				++p;
+			auto const integral_digits = p - integral;
+			auto const* fraction = p;
+			auto fraction_digits = std::ptrdiff_t(0);
+			if(p != last && *p == '.') {
+				fraction = ++p;
+				while(p != last && unsigned(*p - '0') < 10)
+					++p;
+				fraction_digits = p - fraction;
+			}
+			auto exponent = std::int64_t(0);
+			if(p != last) {
+				++p;
+				auto const negative_exponent = *p == '-';
+				if(*p == '+' || *p == '-')
+					++p;
+				for(; p != last; ++p)
+					if(exponent < exponent_limit)
+						exponent = exponent * 10 + (*p - '0');
+				if(negative_exponent)
+					exponent = -exponent;
+			}
+			auto const digits = std::int64_t(integral_digits + fraction_digits);
+			auto const keep = digits + exponent - fraction_digits + std::int64_t(scale);
+			auto const limit = std::uint64_t(INT64_MAX) + negative;
+			auto m = std::uint64_t(0);
+			auto round_digit = 0;
+			auto sticky = false;
+			for(auto i = std::int64_t(0); i != digits; ++i) {
+				auto const d = i < integral_digits ? integral[i] - '0'
+				                                   : fraction[i - integral_digits] - '0';
+				if(i < keep) {
+					if(m > (limit - std::uint64_t(d)) / 10)
+						return false;
+					m = m * 10 + std::uint64_t(d);
+				} else if(i == keep) {
+					round_digit = d;
+				} else {
+					sticky |= d != 0;
+				}
+			}
+			for(auto i = digits; i < keep && m != 0; ++i) {
+				if(m > limit / 10)
+					return false;
+				m *= 10;
+			}
+			auto round_up = false;
+			switch(mode) {
+				case rounding::exact:
+					if(round_digit != 0 || sticky)
+						return false;
+					break;
+				case rounding::toward_zero:
+					break;
+				case rounding::half_away_from_zero:
+					round_up = round_digit >= 5;
+					break;
+				case rounding::half_even:
+					round_up = round_digit > 5 || (round_digit == 5 && (sticky || (m & 1) != 0));
+					break;
+			}
+			if(round_up) {
+				if(m == limit)
+					return false;
+				++m;
+			}
+			result = negative ? std::int64_t(std::uint64_t(0) - m) : std::int64_t(m);
+			return true;
+		}
+		
+		
+		// [first, last) should be a JSON number, number is significand / 10^fraction_digits,
+		// false when significand reaches 2^50 or fraction_digits exceeds 63
+		inline bool parse_decimal_parts(char const* first,
+		                                char const* last,
+		                                std::uint64_t& significand,
+		                                unsigned& fraction_digits) noexcept {
+			constexpr auto limit = std::uint64_t(1) << 50;
+			auto const* p = first + (*first == '-');
+			auto m = std::uint64_t(0);
+			auto exponent = std::int64_t(0);
+			for(; p != last && unsigned(*p - '0') < 10; ++p)
+				if((m = m * 10 + std::uint64_t(*p - '0')) >= limit)
+					return false;
+			if(p != last && *p == '.')
+				for(++p; p != last && unsigned(*p - '0') < 10; ++p, --exponent)
+					if((m = m * 10 + std::uint64_t(*p - '0')) >= limit)
+						return false;
+			if(p != last) {
+				++p;
+				auto const negative_exponent = *p == '-';
+				if(*p == '+' || *p == '-')
+					++p;
+				auto e = std::int64_t(0);
+				for(; p != last; ++p)
+					if(e < 0x10000)
+						e = e * 10 + (*p - '0');
+				exponent += negative_exponent ? -e : e;
+			}
+			for(; exponent > 0 && m != 0; --exponent)
+				if((m *= 10) >= limit)
+					return false;
+			if(exponent < -63)
+				return false;
+			significand = m;
+			fraction_digits = exponent < 0 ? unsigned(-exponent) : 0u;
+			return true;
+		}
+		
+		
+		// [first, last) should be a JSON integer
+		inline bool parse_int(char const* first,
+		                      char const* last,
+		                      std::int64_t& result) noexcept {
+			auto const negative = *first == '-';
+			auto magnitude = std::uint64_t(0);
+			if(!parse_digits(first + negative, last, magnitude))
+				return false;
+			if(magnitude > std::uint64_t(INT64_MAX) + negative)
+				return false;
+			result = negative ? std::int64_t(std::uint64_t(0) - magnitude)
+			                  : std::int64_t(magnitude);
+			return true;
+		}
+		
+		
+		// [first, last) should be a JSON integer
+		inline bool parse_uint(char const* first,
+		                       char const* last,
+		                       std::uint64_t& result) noexcept {
+			if(*first == '-')
+				return false;
+			return parse_digits(first, last, result);
+		}
+		
+		
+		inline void multiply(std::uint64_t a,
+		                     std::uint64_t b,
+		                     std::uint64_t& high,
+		                     std::uint64_t& low) noexcept {
+#if defined(__SIZEOF_INT128__)
+			__extension__ using uint128 = unsigned __int128;
+			auto const product = uint128(a) * b;
+			high = std::uint64_t(product >> 64);
+			low = std::uint64_t(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			low = _umul128(a, b, &high);
+#else
+			auto const a_low = a & 0xFFFFFFFF, a_high = a >> 32;
+			auto const b_low = b & 0xFFFFFFFF, b_high = b >> 32;
+			auto const ll = a_low * b_low, lh = a_low * b_high;
+			auto const hl = a_high * b_low, hh = a_high * b_high;
+			auto const middle = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+			high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+			low = (middle << 32) | (ll & 0xFFFFFFFF);
+#endif
+		}
+		
+		
+		inline unsigned leading_zeros(std::uint64_t word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+			unsigned long index;
+			_BitScanReverse64(&index, word);
+			return 63 - unsigned(index);
+#elif defined(_MSC_VER) && !defined(__clang__)
+			auto n = 0u;
+			for(; (word & (std::uint64_t(1) << 63)) == 0; word <<= 1)
+				++n;
+			return n;
+#else
+			return unsigned(__builtin_clzll(word));
+#endif
+		}
+		
+		
+		// 128-bit truncated 5^q for q in [-342, 308], as in Eisel-Lemire algorithm
+		inline constexpr std::uint64_t power_of_five_128[] = {
+			0xEEF453D6923BD65A, 0x113FAA2906A13B3F, 0x9558B4661B6565F8, 0x4AC7CA59A424C507,
+			0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649, 0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC,
+			0x91D8A02BB6C10594, 0x79071B9B8A4BE869, 0xB64EC836A47146F9, 0x9748E2826CDEE284,
+			0xE3E27A444D8D98B7, 0xFD1B1B2308169B25, 0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7,
+			0xB208EF855C969F4F, 0xBDBD2D335E51A935, 0xDE8B2B66B3BC4723, 0xAD2C788035E61382,
+			0x8B16FB203055AC76, 0x4C3BCB5021AFCC31, 0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D,
+			0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D, 0x87D4713D6F33AA6B, 0x8672648C40E5AD68,
+			0xA9C98D8CCB009506, 0x680EFDAF511F18C2, 0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2,
+			0x84A57695FE98746D, 0x014BB630F7604B57, 0xA5CED43B7E3E9188, 0x419EA3BD35385E2D,
+			0xCF42894A5DCE35EA, 0x52064CAC828675B9, 0x818995CE7AA0E1B2, 0x7343EFEBD1940993,
+			0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8, 0xCA66FA129F9B60A6, 0xD41A26E077774EF6,
+			0xFD00B897478238D0, 0x8920B098955522B4, 0x9E20735E8CB16382, 0x55B46E5F5D5535B0,
+			0xC5A890362FDDBC62, 0xEB2189F734AA831D, 0xF712B443BBD52B7B, 0xA5E9EC7501D523E4,
+			0x9A6BB0AA55653B2D, 0x47B233C92125366E, 0xC1069CD4EABE89F8, 0x999EC0BB696E840A,
+			0xF148440A256E2C76, 0xC00670EA43CA250D, 0x96CD2A865764DBCA, 0x380406926A5E5728,
+			0xBC807527ED3E12BC, 0xC605083704F5ECF2, 0xEBA09271E88D976B, 0xF7864A44C633682E,
+			0x93445B8731587EA3, 0x7AB3EE6AFBE0211D, 0xB8157268FDAE9E4C, 0x5960EA05BAD82964,
+			0xE61ACF033D1A45DF, 0x6FB92487298E33BD, 0x8FD0C16206306BAB, 0xA5D3B6D479F8E056,
+			0xB3C4F1BA87BC8696, 0x8F48A4899877186C, 0xE0B62E2929ABA83C, 0x331ACDABFE94DE87,
+			0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14, 0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9,
+			0xDB71E91432B1A24A, 0xC9E82CD9F69D6150, 0x892731AC9FAF056E, 0xBE311C083A225CD2,
+			0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406, 0xD64D3D9DB981787D, 0x092CBBCCDAD5B108,
+			0x85F0468293F0EB4E, 0x25BBF56008C58EA5, 0xA76C582338ED2621, 0xAF2AF2B80AF6F24E,
+			0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1, 0x82CCA4DB847945CA, 0x50D98D9FC890ED4D,
+			0xA37FCE126597973C, 0xE50FF107BAB528A0, 0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8,
+			0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A, 0x9FAACF3DF73609B1, 0x77B191618C54E9AC,
+			0xC795830D75038C1D, 0xD59DF5B9EF6A2417, 0xF97AE3D0D2446F25, 0x4B0573286B44AD1D,
+			0x9BECCE62836AC577, 0x4EE367F9430AEC32, 0xC2E801FB244576D5, 0x229C41F793CDA73F,
+			0xF3A20279ED56D48A, 0x6B43527578C1110F, 0x9845418C345644D6, 0x830A13896B78AAA9,
+			0xBE5691EF416BD60C, 0x23CC986BC656D553, 0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8,
+			0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9, 0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53,
+			0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68, 0x91376C36D99995BE, 0x23100809B9C21FA1,
+			0xB58547448FFFFB2D, 0xABD40A0C2832A78A, 0xE2E69915B3FFF9F9, 0x16C90C8F323F516C,
+			0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3, 0xB1442798F49FFB4A, 0x99CD11CFDF41779C,
+			0xDD95317F31C7FA1D, 0x40405643D711D583, 0x8A7D3EEF7F1CFC52, 0x482835EA666B2572,
+			0xAD1C8EAB5EE43B66, 0xDA3243650005EECF, 0xD863B256369D4A40, 0x90BED43E40076A82,
+			0x873E4F75E2224E68, 0x5A7744A6E804A291, 0xA90DE3535AAAE202, 0x711515D0A205CB36,
+			0xD3515C2831559A83, 0x0D5A5B44CA873E03, 0x8412D9991ED58091, 0xE858790AFE9486C2,
+			0xA5178FFF668AE0B6, 0x626E974DBE39A872, 0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F,
+			0x80FA687F881C7F8E, 0x7CE66634BC9D0B99, 0xA139029F6A239F72, 0x1C1FFFC1EBC44E80,
+			0xC987434744AC874E, 0xA327FFB266B56220, 0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8,
+			0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9, 0xC4CE17B399107C22, 0xCB550FB4384D21D3,
+			0xF6019DA07F549B2B, 0x7E2A53A146606A48, 0x99C102844F94E0FB, 0x2EDA7444CBFC426D,
+			0xC0314325637A1939, 0xFA911155FEFB5308, 0xF03D93EEBC589F88, 0x793555AB7EBA27CA,
+			0x96267C7535B763B5, 0x4BC1558B2F3458DE, 0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16,
+			0xEA9C227723EE8BCB, 0x465E15A979C1CADC, 0x92A1958A7675175F, 0x0BFACD89EC191EC9,
+			0xB749FAED14125D36, 0xCEF980EC671F667B, 0xE51C79A85916F484, 0x82B7E12780E7401A,
+			0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810, 0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15,
+			0xDFBDCECE67006AC9, 0x67A791E093E1D49A, 0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0,
+			0xAECC49914078536D, 0x58FAE9F773886E18, 0xDA7F5BF590966848, 0xAF39A475506A899E,
+			0x888F99797A5E012D, 0x6D8406C952429603, 0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83,
+			0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64, 0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F,
+			0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E, 0xD0601D8EFC57B08B, 0xF13B94DAF124DA26,
+			0x823C12795DB6CE57, 0x76C53D08D6B70858, 0xA2CB1717B52481ED, 0x54768C4B0C64CA6E,
+			0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09, 0xFE5D54150B090B02, 0xD3F93B35435D7C4C,
+			0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF, 0xC6B8E9B0709F109A, 0x359AB6419CA1091B,
+			0xF867241C8CC6D4C0, 0xC30163D203C94B62, 0x9B407691D7FC44F8, 0x79E0DE63425DCF1D,
+			0xC21094364DFB5636, 0x985915FC12F542E4, 0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D,
+			0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42, 0xBD8430BD08277231, 0x50C6FF782A838353,
+			0xECE53CEC4A314EBD, 0xA4F8BF5635246428, 0x940F4613AE5ED136, 0x871B7795E136BE99,
+			0xB913179899F68584, 0x28E2557B59846E3F, 0xE757DD7EC07426E5, 0x331AEADA2FE589CF,
+			0x9096EA6F3848984F, 0x3FF0D2C85DEF7621, 0xB4BCA50B065ABE63, 0x0FED077A756B53A9,
+			0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894, 0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C,
+			0xB080392CC4349DEC, 0xBD8D794D96AACFB3, 0xDCA04777F541C567, 0xECF0D7A0FC5583A0,
+			0x89E42CAAF9491B60, 0xF41686C49DB57244, 0xAC5D37D5B79B6239, 0x311C2875C522CED5,
+			0xD77485CB25823AC7, 0x7D633293366B828B, 0x86A8D39EF77164BC, 0xAE5DFF9C02033197,
+			0xA8530886B54DBDEB, 0xD9F57F830283FDFC, 0xD267CAA862A12D66, 0xD072DF63C324FD7B,
+			0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D, 0xA46116538D0DEB78, 0x52D9BE85F074E608,
+			0xCD795BE870516656, 0x67902E276C921F8B, 0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6,
+			0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4, 0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD,
+			0xFAD2A4B13D1B5D6C, 0x796B805720085F81, 0x9CC3A6EEC6311A63, 0xCBE3303674053BB0,
+			0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C, 0xF4F1B4D515ACB93B, 0xEE92FB5515482D44,
+			0x991711052D8BF3C5, 0x751BDD152D4D1C4A, 0xBF5CD54678EEF0B6, 0xD262D45A78A0635D,
+			0xEF340A98172AACE4, 0x86FB897116C87C34, 0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0,
+			0xBAE0A846D2195712, 0x8974836059CCA109, 0xE998D258869FACD7, 0x2BD1A438703FC94B,
+			0x91FF83775423CC06, 0x7B6306A34627DDCF, 0xB67F6455292CBF08, 0x1A3BC84C17B1D542,
+			0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93, 0x8E938662882AF53E, 0x547EB47B7282EE9C,
+			0xB23867FB2A35B28D, 0xE99E619A4F23AA43, 0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4,
+			0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04, 0xAE0B158B4738705E, 0x9624AB50B148D445,
+			0xD98DDAEE19068C76, 0x3BADD624DD9B0957, 0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6,
+			0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C, 0xD47487CC8470652B, 0x7647C3200069671F,
+			0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073, 0xA5FB0A17C777CF09, 0xF468107100525890,
+			0xCF79CC9DB955C2CC, 0x7182148D4066EEB4, 0x81AC1FE293D599BF, 0xC6F14CD848405530,
+			0xA21727DB38CB002F, 0xB8ADA00E5A506A7C, 0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C,
+			0xFD442E4688BD304A, 0x908F4A166D1DA663, 0x9E4A9CEC15763E2E, 0x9A598E4E043287FE,
+			0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD, 0xF7549530E188C128, 0xD12BEE59E68EF47C,
+			0x9A94DD3E8CF578B9, 0x82BB74F8301958CE, 0xC13A148E3032D6E7, 0xE36A52363C1FAF01,
+			0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1, 0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9,
+			0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7, 0xEBDF661791D60F56, 0x111B495B3464AD21,
+			0x936B9FCEBB25C995, 0xCAB10DD900BEEC34, 0xB84687C269EF3BFB, 0x3D5D514F40EEA742,
+			0xE65829B3046B0AFA, 0x0CB4A5A3112A5112, 0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB,
+			0xB3F4E093DB73A093, 0x59ED216765690F56, 0xE0F218B8D25088B8, 0x306869C13EC3532C,
+			0x8C974F7383725573, 0x1E414218C73A13FB, 0xAFBD2350644EEACF, 0xE5D1929EF90898FA,
+			0xDBAC6C247D62A583, 0xDF45F746B74ABF39, 0x894BC396CE5DA772, 0x6B8BBA8C328EB783,
+			0xAB9EB47C81F5114F, 0x066EA92F3F326564, 0xD686619BA27255A2, 0xC80A537B0EFEFEBD,
+			0x8613FD0145877585, 0xBD06742CE95F5F36, 0xA798FC4196E952E7, 0x2C48113823B73704,
+			0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5, 0x82EF85133DE648C4, 0x9A984D73DBE722FB,
+			0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA, 0xCC963FEE10B7D1B3, 0x318DF905079926A8,
+			0xFFBBCFE994E5C61F, 0xFDF17746497F7052, 0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633,
+			0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0, 0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0,
+			0x9C1661A651213E2D, 0x06BEA10CA65C084E, 0xC31BFA0FE5698DB8, 0x486E494FCFF30A62,
+			0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA, 0x986DDB5C6B3A76B7, 0xF89629465A75E01C,
+			0xBE89523386091465, 0xF6BBB397F1135823, 0xEE2BA6C0678B597F, 0x746AA07DED582E2C,
+			0x94DB483840B717EF, 0xA8C2A44EB4571CDC, 0xBA121A4650E4DDEB, 0x92F34D62616CE413,
+			0xE896A0D7E51E1566, 0x77B020BAF9C81D17, 0x915E2486EF32CD60, 0x0ACE1474DC1D122E,
+			0xB5B5ADA8AAFF80B8, 0x0D819992132456BA, 0xE3231912D5BF60E6, 0x10E1FFF697ED6C69,
+			0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1, 0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2,
+			0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE, 0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B,
+			0xAD4AB7112EB3929D, 0x86C16C98D2C953C6, 0xD89D64D57A607744, 0xE871C7BF077BA8B7,
+			0x87625F056C7C4A8B, 0x11471CD764AD4972, 0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF,
+			0xD389B47879823479, 0x4AFF1D108D4EC2C3, 0x843610CB4BF160CB, 0xCEDF722A585139BA,
+			0xA54394FE1EEDB8FE, 0xC2974EB4EE658828, 0xCE947A3DA6A9273E, 0x733D226229FEEA32,
+			0x811CCC668829B887, 0x0806357D5A3F525F, 0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7,
+			0xC9BCFF6034C13052, 0xFC89B393DD02F0B5, 0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2,
+			0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D, 0xC5029163F384A931, 0x0A9E795E65D4DF11,
+			0xF64335BCF065D37D, 0x4D4617B5FF4A16D5, 0x99EA0196163FA42E, 0x504BCED1BF8E4E45,
+			0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6, 0xF07DA27A82C37088, 0x5D767327BB4E5A4C,
+			0x964E858C91BA2655, 0x3A6A07F8D510F86F, 0xBBE226EFB628AFEA, 0x890489F70A55368B,
+			0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E, 0x92C8AE6B464FC96F, 0x3B0B8BC90012929D,
+			0xB77ADA0617E3BBCB, 0x09CE6EBB40173744, 0xE55990879DDCAABD, 0xCC420A6A101D0515,
+			0x8F57FA54C2A9EAB6, 0x9FA946824A12232D, 0xB32DF8E9F3546564, 0x47939822DC96ABF9,
+			0xDFF9772470297EBD, 0x59787E2B93BC56F7, 0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A,
+			0xAEFAE51477A06B03, 0xEDE622920B6B23F1, 0xDAB99E59958885C4, 0xE95FAB368E45ECED,
+			0x88B402F7FD75539B, 0x11DBCB0218EBB414, 0xAAE103B5FCD2A881, 0xD652BDC29F26A119,
+			0xD59944A37C0752A2, 0x4BE76D3346F0495F, 0x857FCAE62D8493A5, 0x6F70A4400C562DDB,
+			0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952, 0xD097AD07A71F26B2, 0x7E2000A41346A7A7,
+			0x825ECC24C873782F, 0x8ED400668C0C28C8, 0xA2F67F2DFA90563B, 0x728900802F0F32FA,
+			0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9, 0xFEA126B7D78186BC, 0xE2F610C84987BFA8,
+			0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9, 0xC6EDE63FA05D3143, 0x91503D1C79720DBB,
+			0xF8A95FCF88747D94, 0x75A44C6397CE912A, 0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA,
+			0xC24452DA229B021B, 0xFBE85BADCE996168, 0xF2D56790AB41C2A2, 0xFAE27299423FB9C3,
+			0x97C560BA6B0919A5, 0xDCCD879FC967D41A, 0xBDB6B8E905CB600F, 0x5400E987BBC1C920,
+			0xED246723473E3813, 0x290123E9AAB23B68, 0x9436C0760C86E30B, 0xF9A0B6720AAF6521,
+			0xB94470938FA89BCE, 0xF808E40E8D5B3E69, 0xE7958CB87392C2C2, 0xB60B1D1230B20E04,
+			0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2, 0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3,
+			0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0, 0x8D590723948A535F, 0x579C487E5A38AD0E,
+			0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851, 0xDCDB1B2798182244, 0xF8E431456CF88E65,
+			0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF, 0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F,
+			0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F, 0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9,
+			0xA87FEA27A539E9A5, 0x3F2398D747B36224, 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD,
+			0x83A3EEEEF9153E89, 0x1953CF68300424AC, 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7,
+			0xCDB02555653131B6, 0x3792F412CB06794D, 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0,
+			0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4, 0xC8DE047564D20A8B, 0xF245825A5A445275,
+			0xFB158592BE068D2E, 0xEED6E2F0F0D56712, 0x9CED737BB6C4183D, 0x55464DD69685606B,
+			0xC428D05AA4751E4C, 0xAA97E14C3C26B886, 0xF53304714D9265DF, 0xD53DD99F4B3066A8,
+			0x993FE2C6D07B7FAB, 0xE546A8038EFE4029, 0xBF8FDB78849A5F96, 0xDE98520472BDD033,
+			0xEF73D256A5C0F77C, 0x963E66858F6D4440, 0x95A8637627989AAD, 0xDDE7001379A44AA8,
+			0xBB127C53B17EC159, 0x5560C018580D5D52, 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6,
+			0x9226712162AB070D, 0xCAB3961304CA70E8, 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22,
+			0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A, 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242,
+			0xB267ED1940F1C61C, 0x55F038B237591ED3, 0xDF01E85F912E37A3, 0x6B6C46DEC52F6688,
+			0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015, 0xAE397D8AA96C1B77, 0xABEC975E0A0D081A,
+			0xD9C7DCED53C72255, 0x96E7BD358C904A21, 0x881CEA14545C7575, 0x7E50D64177DA2E54,
+			0xAA242499697392D2, 0xDDE50BD1D5D0B9E9, 0xD4AD2DBFC3D07787, 0x955E4EC64B44E864,
+			0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E, 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E,
+			0xCFB11EAD453994BA, 0x67DE18EDA5814AF2, 0x81CEB32C4B43FCF4, 0x80EACF948770CED7,
+			0xA2425FF75E14FC31, 0xA1258379A94D028D, 0xCAD2F7F5359A3B3E, 0x096EE45813A04330,
+			0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC, 0x9E74D1B791E07E48, 0x775EA264CF55347E,
+			0xC612062576589DDA, 0x95364AFE032A819E, 0xF79687AED3EEC551, 0x3A83DDBD83F52205,
+			0x9ABE14CD44753B52, 0xC4926A9672793543, 0xC16D9A0095928A27, 0x75B7053C0F178294,
+			0xF1C90080BAF72CB1, 0x5324C68B12DD6339, 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04,
+			0xBCE5086492111AEA, 0x88F4BB1CA6BCF585, 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6,
+			0x9392EE8E921D5D07, 0x3AFF322E62439FD0, 0xB877AA3236A4B449, 0x09BEFEB9FAD487C3,
+			0xE69594BEC44DE15B, 0x4C2EBE687989A9B4, 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11,
+			0xB424DC35095CD80F, 0x538484C19EF38C95, 0xE12E13424BB40E13, 0x2865A5F206B06FBA,
+			0x8CBCCC096F5088CB, 0xF93F87B7442E45D4, 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749,
+			0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C, 0x89705F4136B4A597, 0x31680A88F8953031,
+			0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E, 0xD6BF94D5E57A42BC, 0x3D32907604691B4D,
+			0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110, 0xA7C5AC471B478423, 0x0FCF80DC33721D54,
+			0xD1B71758E219652B, 0xD3C36113404EA4A9, 0x83126E978D4FDF3B, 0x645A1CAC083126EA,
+			0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4, 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD,
+			0x8000000000000000, 0x0000000000000000, 0xA000000000000000, 0x0000000000000000,
+			0xC800000000000000, 0x0000000000000000, 0xFA00000000000000, 0x0000000000000000,
+			0x9C40000000000000, 0x0000000000000000, 0xC350000000000000, 0x0000000000000000,
+			0xF424000000000000, 0x0000000000000000, 0x9896800000000000, 0x0000000000000000,
+			0xBEBC200000000000, 0x0000000000000000, 0xEE6B280000000000, 0x0000000000000000,
+			0x9502F90000000000, 0x0000000000000000, 0xBA43B74000000000, 0x0000000000000000,
+			0xE8D4A51000000000, 0x0000000000000000, 0x9184E72A00000000, 0x0000000000000000,
+			0xB5E620F480000000, 0x0000000000000000, 0xE35FA931A0000000, 0x0000000000000000,
+			0x8E1BC9BF04000000, 0x0000000000000000, 0xB1A2BC2EC5000000, 0x0000000000000000,
+			0xDE0B6B3A76400000, 0x0000000000000000, 0x8AC7230489E80000, 0x0000000000000000,
+			0xAD78EBC5AC620000, 0x0000000000000000, 0xD8D726B7177A8000, 0x0000000000000000,
+			0x878678326EAC9000, 0x0000000000000000, 0xA968163F0A57B400, 0x0000000000000000,
+			0xD3C21BCECCEDA100, 0x0000000000000000, 0x84595161401484A0, 0x0000000000000000,
+			0xA56FA5B99019A5C8, 0x0000000000000000, 0xCECB8F27F4200F3A, 0x0000000000000000,
+			0x813F3978F8940984, 0x4000000000000000, 0xA18F07D736B90BE5, 0x5000000000000000,
+			0xC9F2C9CD04674EDE, 0xA400000000000000, 0xFC6F7C4045812296, 0x4D00000000000000,
+			0x9DC5ADA82B70B59D, 0xF020000000000000, 0xC5371912364CE305, 0x6C28000000000000,
+			0xF684DF56C3E01BC6, 0xC732000000000000, 0x9A130B963A6C115C, 0x3C7F400000000000,
+			0xC097CE7BC90715B3, 0x4B9F100000000000, 0xF0BDC21ABB48DB20, 0x1E86D40000000000,
+			0x96769950B50D88F4, 0x1314448000000000, 0xBC143FA4E250EB31, 0x17D955A000000000,
+			0xEB194F8E1AE525FD, 0x5DCFAB0800000000, 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000,
+			0xB7ABC627050305AD, 0xF14A3D9E40000000, 0xE596B7B0C643C719, 0x6D9CCD05D0000000,
+			0x8F7E32CE7BEA5C6F, 0xE4820023A2000000, 0xB35DBF821AE4F38B, 0xDDA2802C8A800000,
+			0xE0352F62A19E306E, 0xD50B2037AD200000, 0x8C213D9DA502DE45, 0x4526F422CC340000,
+			0xAF298D050E4395D6, 0x9670B12B7F410000, 0xDAF3F04651D47B4C, 0x3C0CDD765F114000,
+			0x88D8762BF324CD0F, 0xA5880A69FB6AC800, 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00,
+			0xD5D238A4ABE98068, 0x72A4904598D6D880, 0x85A36366EB71F041, 0x47A6DA2B7F864750,
+			0xA70C3C40A64E6C51, 0x999090B65F67D924, 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D,
+			0x82818F1281ED449F, 0xBFF8F10E7A8921A4, 0xA321F2D7226895C7, 0xAFF72D52192B6A0D,
+			0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490, 0xFEE50B7025C36A08, 0x02F236D04753D5B4,
+			0x9F4F2726179A2245, 0x01D762422C946590, 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5,
+			0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2, 0x9B934C3B330C8577, 0x63CC55F49F88EB2F,
+			0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB, 0xF316271C7FC3908A, 0x8BEF464E3945EF7A,
+			0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC, 0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317,
+			0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD, 0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A,
+			0xB975D6B6EE39E436, 0xB3E2FD538E122B44, 0xE7D34C64A9C85D44, 0x60DBBCA87196B616,
+			0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD, 0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41,
+			0xE264589A4DCDAB14, 0xC696963C7EED2DD1, 0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2,
+			0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB, 0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE,
+			0x8A2DBF142DFCC7AB, 0x6E3569326C784337, 0xACB92ED9397BF996, 0x49C2C37F07965404,
+			0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906, 0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3,
+			0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C, 0xD2D80DB02AABD62B, 0xF50A3FA490C30190,
+			0x83C7088E1AAB65DB, 0x792667C6DA79E0FA, 0xA4B8CAB1A1563F52, 0x577001B891185938,
+			0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86, 0x80B05E5AC60B6178, 0x544F8158315B05B4,
+			0xA0DC75F1778E39D6, 0x696361AE3DB1C721, 0xC913936DD571C84C, 0x03BC3A19CD1E38E9,
+			0xFB5878494ACE3A5F, 0x04AB48A04065C723, 0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76,
+			0xC45D1DF942711D9A, 0x3BA5D0BD324F8394, 0xF5746577930D6500, 0xCA8F44EC7EE36479,
+			0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB, 0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E,
+			0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E, 0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12,
+			0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97, 0xEA1575143CF97226, 0xF52D09D71A3293BD,
+			0x924D692CA61BE758, 0x593C2626705F9C56, 0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C,
+			0xE498F455C38B997A, 0x0B6DFB9C0F956447, 0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC,
+			0xB2977EE300C50FE7, 0x58EDEC91EC2CB657, 0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED,
+			0x8B865B215899F46C, 0xBD79E0D20082EE74, 0xAE67F1E9AEC07187, 0xECD8590680A3AA11,
+			0xDA01EE641A708DE9, 0xE80E6F4820CC9495, 0x884134FE908658B2, 0x3109058D147FDCDD,
+			0xAA51823E34A7EEDE, 0xBD4B46F0599FD415, 0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A,
+			0x850FADC09923329E, 0x03E2CF6BC604DDB0, 0xA6539930BF6BFF45, 0x84DB8346B786151C,
+			0xCFE87F7CEF46FF16, 0xE612641865679A63, 0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E,
+			0xA26DA3999AEF7749, 0xE3BE5E330F38F09D, 0xCB090C8001AB551C, 0x5CADF5BFD3072CC5,
+			0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6, 0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA,
+			0xC646D63501A1511D, 0xB281E1FD541501B8, 0xF7D88BC24209A565, 0x1F225A7CA91A4226,
+			0x9AE757596946075F, 0x3375788DE9B06958, 0xC1A12D2FC3978937, 0x0052D6B1641C83AE,
+			0xF209787BB47D6B84, 0xC0678C5DBD23A49A, 0x9745EB4D50CE6332, 0xF840B7BA963646E0,
+			0xBD176620A501FBFF, 0xB650E5A93BC3D898, 0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE,
+			0x93BA47C980E98CDF, 0xC66F336C36B10137, 0xB8A8D9BBE123F017, 0xB80B0047445D4184,
+			0xE6D3102AD96CEC1D, 0xA60DC059157491E5, 0x9043EA1AC7E41392, 0x87C89837AD68DB2F,
+			0xB454E4A179DD1877, 0x29BABE4598C311FB, 0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A,
+			0x8CE2529E2734BB1D, 0x1899E4A65F58660C, 0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F,
+			0xDC21A1171D42645D, 0x76707543F4FA1F73, 0x899504AE72497EBA, 0x6A06494A791C53A8,
+			0xABFA45DA0EDBDE69, 0x0487DB9D17636892, 0xD6F8D7509292D603, 0x45A9D2845D3C42B6,
+			0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2, 0xA7F26836F282B732, 0x8E6CAC7768D7141E,
+			0xD1EF0244AF2364FF, 0x3207D795430CD926, 0x8335616AED761F1F, 0x7F44E6BD49E807B8,
+			0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6, 0xCD036837130890A1, 0x36DBA887C37A8C0F,
+			0x802221226BE55A64, 0xC2494954DA2C9789, 0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C,
+			0xC83553C5C8965D3D, 0x6F92829494E5ACC7, 0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9,
+			0x9C69A97284B578D7, 0xFF2A760414536EFB, 0xC38413CF25E2D70D, 0xFEF5138519684ABA,
+			0xF46518C2EF5B8CD1, 0x7EB258665FC25D69, 0x98BF2F79D5993802, 0xEF2F773FFBD97A61,
+			0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA, 0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38,
+			0x952AB45CFA97A0B2, 0xDD945A747BF26183, 0xBA756174393D88DF, 0x94F971119AEEF9E4,
+			0xE912B9D1478CEB17, 0x7A37CD5601AAB85D, 0x91ABB422CCB812EE, 0xAC62E055C10AB33A,
+			0xB616A12B7FE617AA, 0x577B986B314D6009, 0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B,
+			0x8E41ADE9FBEBC27D, 0x14588F13BE847307, 0xB1D219647AE6B31C, 0x596EB2D8AE258FC8,
+			0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB, 0x8AEC23D680043BEE, 0x25DE7BB9480D5854,
+			0xADA72CCC20054AE9, 0xAF561AA79A10AE6A, 0xD910F7FF28069DA4, 0x1B2BA1518094DA04,
+			0x87AA9AFF79042286, 0x90FB44D2F05D0842, 0xA99541BF57452B28, 0x353A1607AC744A53,
+			0xD3FA922F2D1675F2, 0x42889B8997915CE8, 0x847C9B5D7C2E09B7, 0x69956135FEBADA11,
+			0xA59BC234DB398C25, 0x43FAB9837E699095, 0xCF02B2C21207EF2E, 0x94F967E45E03F4BB,
+			0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5, 0xA1BA1BA79E1632DC, 0x6462D92A69731732,
+			0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE, 0xFCB2CB35E702AF78, 0x5CDA735244C3D43E,
+			0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7, 0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0,
+			0xF6C69A72A3989F5B, 0x8AAD549E57273D45, 0x9A3C2087A63F6399, 0x36AC54E2F678864B,
+			0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD, 0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5,
+			0x969EB7C47859E743, 0x9F644AE5A4B1B325, 0xBC4665B596706114, 0x873D5D9F0DDE1FEE,
+			0xEB57FF22FC0C7959, 0xA90CB506D155A7EA, 0x9316FF75DD87CBD8, 0x09A7F12442D588F2,
+			0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F, 0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA,
+			0x8FA475791A569D10, 0xF96E017D694487BC, 0xB38D92D760EC4455, 0x37C981DCC395A9AC,
+			0xE070F78D3927556A, 0x85BBE253F47B1417, 0x8C469AB843B89562, 0x93956D7478CCEC8E,
+			0xAF58416654A6BABB, 0x387AC8D1970027B2, 0xDB2E51BFE9D0696A, 0x06997B05FCC0319E,
+			0x88FCF317F22241E2, 0x441FECE3BDF81F03, 0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3,
+			0xD60B3BD56A5586F1, 0x8A71E223D8D3B074, 0x85C7056562757456, 0xF6872D5667844E49,
+			0xA738C6BEBB12D16C, 0xB428F8AC016561DB, 0xD106F86E69D785C7, 0xE13336D701BEBA52,
+			0x82A45B450226B39C, 0xECC0024661173473, 0xA34D721642B06084, 0x27F002D7F95D0190,
+			0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4, 0xFF290242C83396CE, 0x7E67047175A15271,
+			0x9F79A169BD203E41, 0x0F0062C6E984D386, 0xC75809C42C684DD1, 0x52C07B78A3E60868,
+			0xF92E0C3537826145, 0xA7709A56CCDF8A82, 0x9BBCC7A142B17CCB, 0x88A66076400BB691,
+			0xC2ABF989935DDBFE, 0x6ACFF893D00EA435, 0xF356F7EBF83552FE, 0x0583F6B8C4124D43,
+			0x98165AF37B2153DE, 0xC3727A337A8B704A, 0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C,
+			0xEDA2EE1C7064130C, 0x1162DEF06F79DF73, 0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8,
+			0xB9A74A0637CE2EE1, 0x6D953E2BD7173692, 0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437,
+			0x910AB1D4DB9914A0, 0x1D9C9892400A22A2, 0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B,
+			0xE2A0B5DC971F303A, 0x2E44AE64840FD61D, 0x8DA471A9DE737E24, 0x5CEAECFED289E5D2,
+			0xB10D8E1456105DAD, 0x7425A83E872C5F47, 0xDD50F1996B947518, 0xD12F124E28F77719,
+			0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F, 0xACE73CBFDC0BFB7B, 0x636CC64D1001550B,
+			0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E, 0x8714A775E3E95C78, 0x65ACFAEC34810A71,
+			0xA8D9D1535CE3B396, 0x7F1839A741A14D0D, 0xD31045A8341CA07C, 0x1EDE48111209A050,
+			0x83EA2B892091E44D, 0x934AED0AAB460432, 0xA4E4B66B68B65D60, 0xF81DA84D5617853F,
+			0xCE1DE40642E3F4B9, 0x36251260AB9D668E, 0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019,
+			0xA1075A24E4421730, 0xB24CF65B8612F81F, 0xC94930AE1D529CFC, 0xDEE033F26797B627,
+			0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1, 0x9D412E0806E88AA5, 0x8E1F289560EE864E,
+			0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2, 0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB,
+			0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29, 0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3,
+			0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0, 0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E,
+			0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1, 0xEA53DF5FD18D5513, 0x84C86189216DC5ED,
+			0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4, 0xB7118682DBB66A77, 0x3FBC8C33221DC2A1,
+			0xE4D5E82392A40515, 0x0FABAF3FEAA5334A, 0x8F05B1163BA6832D, 0x29CB4D87F2A7400E,
+			0xB2C71D5BCA9023F8, 0x743E20E9EF511012, 0xDF78E4B2BD342CF6, 0x914DA9246B255416,
+			0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E, 0xAE9672ABA3D0C320, 0xA184AC2473B529B1,
+			0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E, 0x8865899617FB1871, 0x7E2FA67C7A658892,
+			0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7, 0xD51EA6FA85785631, 0x552A74227F3EA565,
+			0x8533285C936B35DE, 0xD53A88958F87275F, 0xA67FF273B8460356, 0x8A892ABAF368F137,
+			0xD01FEF10A657842C, 0x2D2B7569B0432D85, 0x8213F56A67F6B29B, 0x9C3B29620E29FC73,
+			0xA298F2C501F45F42, 0x8349F3BA91B47B8F, 0xCB3F2F7642717713, 0x241C70A936219A73,
+			0xFE0EFB53D30DD4D7, 0xED238CD383AA0110, 0x9EC95D1463E8A506, 0xF4363804324A40AA,
+			0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5, 0xF81AA16FDC1B81DA, 0xDD94B7868E94050A,
+			0x9B10A4E5E9913128, 0xCA7CF2B4191C8326, 0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0,
+			0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC, 0x976E41088617CA01, 0xD5BE0503E085D813,
+			0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18, 0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E,
+			0x93E1AB8252F33B45, 0xCABB90E5C942B503, 0xB8DA1662E7B00A17, 0x3D6A751F3B936243,
+			0xE7109BFBA19C0C9D, 0x0CC512670A783AD4, 0x906A617D450187E2, 0x27FB2B80668B24C5,
+			0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6, 0xE1A63853BBD26451, 0x5E7873F8A0396973,
+			0x8D07E33455637EB2, 0xDB0B487B6423E1E8, 0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62,
+			0xDC5C5301C56B75F7, 0x7641A140CC7810FB, 0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D,
+			0xAC2820D9623BF429, 0x546345FA9FBDCD44, 0xD732290FBACAF133, 0xA97C177947AD4095,
+			0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D, 0xA81F301449EE8C70, 0x5C68F256BFFF5A74,
+			0xD226FC195C6A2F8C, 0x73832EEC6FFF3111, 0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB,
+			0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55, 0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB,
+			0x80444B5E7AA7CF85, 0x7980D163CF5B81B3, 0xA0555E361951C366, 0xD7E105BCC332621F,
+			0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7, 0xFA856334878FC150, 0xB14F98F6F0FEB951,
+			0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3, 0xC3B8358109E84F07, 0x0A862F80EC4700C8,
+			0xF4A642E14C6262C8, 0xCD27BB612758C0FA, 0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C,
+			0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3, 0xEEEA5D5004981478, 0x1858CCFCE06CAC74,
+			0x95527A5202DF0CCB, 0x0F37801E0C43EBC8, 0xBAA718E68396CFFD, 0xD30560258F54E6BA,
+			0xE950DF20247C83FD, 0x47C6B82EF32A2069, 0x91D28B7416CDD27E, 0x4CDC331D57FA5441,
+			0xB6472E511C81471D, 0xE0133FE4ADF8E952, 0xE3D8F9E563A198E5, 0x58180FDDD97723A6,
+			0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648
+		};
+		
+		
+		// w * 10^q for nonzero w, returns false when result is not a finite nonzero double
+		inline bool eisel_lemire(std::uint64_t w,
+		                         std::int64_t q,
+		                         std::uint64_t& bits) noexcept {
+			constexpr auto smallest_power = -342;
+			constexpr auto largest_power = 308;
+			constexpr auto mantissa_bits = 52;
+			constexpr auto minimum_exponent = -1023;
+			constexpr auto infinite_power = 0x7FF;
+			if(q < smallest_power || q > largest_power)
+				return false;
+			auto const lz = int(leading_zeros(w));
+			w <<= lz;
+			auto const index = std::size_t(2 * (q - smallest_power));
+			auto high = std::uint64_t(0), low = std::uint64_t(0);
+			multiply(w, power_of_five_128[index], high, low);
+			constexpr auto precision_mask = ~std::uint64_t(0) >> (mantissa_bits + 3);
+			if((high & precision_mask) == precision_mask) {
+				auto second_high = std::uint64_t(0), second_low = std::uint64_t(0);
+				multiply(w, power_of_five_128[index + 1], second_high, second_low);
+				low += second_high;
+				if(second_high > low)
+					++high;
+			}
+			auto const upper_bit = int(high >> 63);
+			auto const shift = upper_bit + 64 - mantissa_bits - 3;
+			auto mantissa = high >> shift;
+			auto power2 = int((((152170 + 65536) * q) >> 16) + 63) + upper_bit - lz - minimum_exponent;
+			if(power2 <= 0) {
+				if(-power2 + 1 >= 64)
+					return false;
+				mantissa >>= -power2 + 1;
+				mantissa += mantissa & 1;
+				mantissa >>= 1;
+				if(mantissa == 0)
+					return false;
+				power2 = mantissa < (std::uint64_t(1) << mantissa_bits) ? 0 : 1;
+				bits = (mantissa & ~(std::uint64_t(1) << mantissa_bits))
+					| (std::uint64_t(power2) << mantissa_bits);
+				return true;
+			}
+			if(low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1
+			   && (mantissa << shift) == high)
+				mantissa &= ~std::uint64_t(1);
+			mantissa += mantissa & 1;
+			mantissa >>= 1;
+			if(mantissa >= (std::uint64_t(2) << mantissa_bits)) {
+				mantissa = std::uint64_t(1) << mantissa_bits;
+				++power2;
+			}
+			mantissa &= ~(std::uint64_t(1) << mantissa_bits);
+			if(power2 >= infinite_power)
+				return false;
+			bits = mantissa | (std::uint64_t(power2) << mantissa_bits);
+			return true;
+		}
+		
+		
+		// [first, last) should be a JSON number, returns false when it is out of double range
+		inline bool parse_double(char const* first,
+		                         char const* last,
+		                         double& result) noexcept {
+			auto const* p = first;
+			auto const negative = *p == '-';
+			p += negative;
+			auto w = std::uint64_t(0);
+			auto significant = 0;
+			auto exponent = std::int64_t(0);
+			for(; p != last && unsigned(*p - '0') < 10; ++p) {
+				w = w * 10 + std::uint64_t(*p - '0');
+				significant += significant != 0 || *p != '0';
+			}
+			if(p != last && *p == '.')
+				for(++p; p != last && unsigned(*p - '0') < 10; ++p) {
+					w = w * 10 + std::uint64_t(*p - '0');
+					significant += significant != 0 || *p != '0';
+					--exponent;
+				}
+			if(p != last) {
+				++p;
+				auto const negative_exponent = *p == '-';
+				if(*p == '+' || *p == '-')
+					++p;
+				auto e = std::int64_t(0);
+				for(; p != last; ++p)
+					if(e < 0x10000)
+						e = e * 10 + (*p - '0');
+				exponent += negative_exponent ? -e : e;
+			}
+			if(significant > 19)
+				return std::from_chars(first, last, result).ec == std::errc{};
+			if(w == 0) {
+				result = negative ? -0.0 : 0.0;
+				return true;
+			}
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+			constexpr double exact_powers_of_ten[] = {
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+			};
+			if(w <= (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+				result = exponent < 0 ? double(w) / exact_powers_of_ten[-exponent]
+				                      : double(w) * exact_powers_of_ten[exponent];
+				if(negative)
+					result = -result;
+				return true;
+			}
+#endif
+			auto bits = std::uint64_t(0);
+			if(!eisel_lemire(w, exponent, bits))
+				return false;
+			bits |= std::uint64_t(negative) << 63;
+			std::memcpy(&result, &bits, sizeof(result));
+			return true;
+		}
+		
+		
+	} // namespace detail
+	
+	
 	class parser;
+	class field_ref;
+	class document;
+	class compact_value;
+	template<auto const& Keys> class dispatcher;
 	class value {
 	friend class parser;
+	friend class document;
+	friend class field_ref;
+	friend class compact_value;
+	template<auto const& Keys> friend class dispatcher;
 	
 		value_tag tag_;
 		value_data data_;
 		
 		static const value null;
 		
+		static constexpr value_tag::size_type decoded_int = 1;
+		static constexpr value_tag::size_type decoded_uint = 2;
+		static constexpr value_tag::size_type decoded_double = 3;
+		static constexpr value_tag::size_type decoded_mask = 3;
+		static constexpr value_tag::size_type number_fraction = 4;
+		static constexpr value_tag::size_type number_exponent = 8;
+		static constexpr value_tag::size_type number_nonintegral = number_fraction | number_exponent;
+		static constexpr unsigned fraction_digits_bits = 6;
+		static constexpr value_tag::size_type fraction_digits_mask = (1u << fraction_digits_bits) - 1;
+		
+		static value_tag::size_type key_payload(std::string_view name) noexcept {
+			return value_tag::payload(name.size(), detail::key_hash(name));
+		}
+		
+		
+		std::uint32_t key_signature() const noexcept {
+			if constexpr(value_tag::aux_bits != 0)
+				return std::uint32_t(tag_.aux());
+			else
+				return detail::key_hash({data_.text, tag_.length()}) & detail::key_signature_mask;
+		}
+		
+		
+		bool is_key(value_tag::size_type payload, std::string_view name) const noexcept {
+			return tag_.payload() == payload
+				&& std::string_view{data_.text, tag_.length()} == name;
+		}
+		
+		
+		// moves text pointers inside [from, from + size] to the same offsets from to
+		static void rebase(value* first,
+		                   value* last,
+		                   char const* from,
+		                   char* to,
+		                   std::size_t size) noexcept {
+			if(from == to)
+				return;
+			auto const begin = std::uintptr_t(from);
+			for(; first != last; ++first) {
+				auto const has_text = first->tag_.type() == value_type::string
+					|| (first->tag_.type() == value_type::number
+					    && (first->tag_.flags() & decoded_mask) == 0);
+				auto const at = std::uintptr_t(first->data_.text);
+				if(has_text && at >= begin && at - begin <= size)
+					first->data_.text = to + (at - begin);
+			}
+		}
+		
+		
 		static value const* next_of(value const* it) noexcept {
 			switch(it->tag_.type()) {
 				case value_type::array:
@@ -205,6 +1138,9 @@ namespace jessy {
 		
 		class object {
 		friend class value;
+		friend class parser;
+		friend class field_ref;
+		template<auto const& Keys> friend class dispatcher;
 		
 			value_tag::size_type length_;
 			value const* begin_;
@@ -215,6 +1151,8 @@ namespace jessy {
 			
 			class const_iterator {
 			friend class object;
+			friend class parser;
+			friend class field_ref;
 				value const* key_;
 				value const* value_;
 			public:
@@ -276,31 +1214,44 @@ namespace jessy {
 			}
 			
 			const_iterator find(const_iterator from, std::string_view name) const noexcept {
+				auto const payload = key_payload(name);
 				auto const* it = from.key_;
 				while(it != end_) {
-					auto const key = std::string_view{it->data_.text,
-					                                  it->tag_.length()};
-					if(key == name)
+					if(it->is_key(payload, name))
 						return const_iterator{it};
 					it = next_of(it + 1);
 				}
 				it = begin_;
 				while(it != from.key_) {
-					auto const key = std::string_view{it->data_.text,
-					                                  it->tag_.length()};
-					if(key == name)
+					if(it->is_key(payload, name))
 						return const_iterator{it};
 					it = next_of(it + 1);
 				}
 				return const_iterator{end_};
 			}
 			
+			
+			// identifier of key sequence when parsed with options::cache_shapes, 0 otherwise
+			size_type shape() const noexcept {
+				return (begin_ - 1)->tag_.aux();
+			}
+			
 		private:
 		
 			object(size_type length,
 			       value const* begin,
 				   value const* end) noexcept
 			: length_{length}, begin_{begin}, end_{end} { }
+			
+			
+			value const* member(size_type n) const noexcept {
+				if(size_type(end_ - begin_) == length_ * 2)
+					return begin_ + n * 2;
+				auto const* it = begin_;
+				for(; n != 0; --n)
+					it = next_of(it + 1);
+				return it;
+			}
 		}; // object
 	
 	
@@ -337,7 +1288,19 @@ namespace jessy {
 		
 		constexpr bool is_null() const noexcept {
 			return tag_.type() == value_type::null;
-		}		
+		}
+		
+		
+		constexpr bool is_integer() const noexcept {
+			return tag_.type() == value_type::number
+				&& (tag_.flags() & number_nonintegral) == 0;
+		}
+		
+		
+		constexpr bool is_float() const noexcept {
+			return tag_.type() == value_type::number
+				&& (tag_.flags() & number_nonintegral) != 0;
+		}
 		
 		
 		std::optional<bool> as_bool() const noexcept {
@@ -348,44 +1311,112 @@ namespace jessy {
 		
 		
 		std::optional<std::int64_t> as_int() const noexcept {
-			if(tag_.type() != value_type::number)
-				return std::nullopt;
-			auto result = 0ll;
-			auto const converted = std::from_chars(data_.text,
-			                                       data_.text + tag_.length(),
-												   result);
-			if(converted.ec != std::errc{})
+			if(!is_integer())
 				return std::nullopt;
-			return {result};
+			switch(tag_.flags() & decoded_mask) {
+				case decoded_int:
+					return {data_.integer};
+				case decoded_uint:
+				case decoded_double:
+					return std::nullopt;
+				default:
+					return text_to_int();
+			}
 		}
 		
 		
 		std::optional<std::uint64_t> as_uint() const noexcept {
-			if(tag_.type() != value_type::number)
+			if(!is_integer())
 				return std::nullopt;
-			auto result = 0ull;
-			auto const converted = std::from_chars(data_.text,
-			                                       data_.text + tag_.length(),
-												   result);
-			if(converted.ec != std::errc{})
-				return std::nullopt;
-			return {result};
+			switch(tag_.flags() & decoded_mask) {
+				case decoded_int:
+					if(data_.integer < 0)
+						return std::nullopt;
+					return {std::uint64_t(data_.integer)};
+				case decoded_uint:
+					return {data_.uinteger};
+				case decoded_double:
+					return std::nullopt;
+				default:
+					return text_to_uint();
+			}
 		}
 		
 		
 		std::optional<double> as_double() const noexcept {
 			if(tag_.type() != value_type::number)
 				return std::nullopt;
+			switch(tag_.flags() & decoded_mask) {
+				case decoded_int:
+					return {double(data_.integer)};
+				case decoded_uint:
+					return {double(data_.uinteger)};
+				case decoded_double:
+					return {data_.real};
+				default:
+					break;
+			}
 			auto result = 0.0;
-			auto const converted = std::from_chars(data_.text,
-			                                       data_.text + tag_.length(),
-												   result);
-			if(converted.ec != std::errc{})
+			if(!detail::parse_double(data_.text, data_.text + tag_.length(), result))
 				return std::nullopt;
 			return {result};
 		}
 		
 		
+		std::optional<std::int64_t> as_decimal(unsigned scale,
+		                                       rounding mode = rounding::half_even) const noexcept {
+			if(tag_.type() != value_type::number)
+				return std::nullopt;
+			auto result = std::int64_t(0);
+			switch(tag_.flags() & decoded_mask) {
+				case decoded_int: {
+					auto magnitude = data_.integer < 0 ? std::uint64_t(0) - std::uint64_t(data_.integer)
+					                                   : std::uint64_t(data_.integer);
+					auto const limit = std::uint64_t(INT64_MAX) + (data_.integer < 0);
+					for(auto i = 0u; i != scale && magnitude != 0; ++i) {
+						if(magnitude > limit / 10)
+							return std::nullopt;
+						magnitude *= 10;
+					}
+					return {data_.integer < 0 ? std::int64_t(std::uint64_t(0) - magnitude)
+					                          : std::int64_t(magnitude)};
+				}
+				case decoded_uint:
+					return std::nullopt;
+				case decoded_double: {
+					// significand and fraction digits kept in payload are written back as text
+					char text[32];
+					auto* p = text + 24;
+					auto* const last = p;
+					auto significand = tag_.payload() >> fraction_digits_bits;
+					do {
+						*--p = char('0' + significand % 10);
+						significand /= 10;
+					} while(significand != 0);
+					if(data_.real < 0)
+						*--p = '-';
+					auto const fraction_digits = unsigned(tag_.payload() & fraction_digits_mask);
+					auto* end = last;
+					*end++ = 'e';
+					*end++ = '-';
+					*end++ = char('0' + fraction_digits / 10);
+					*end++ = char('0' + fraction_digits % 10);
+					if(!detail::parse_decimal(p, end, scale, mode, result))
+						return std::nullopt;
+					return {result};
+				}
+				default:
+					if(!detail::parse_decimal(data_.text,
+					                          data_.text + tag_.length(),
+					                          scale,
+					                          mode,
+					                          result))
+						return std::nullopt;
+					return {result};
+			}
+		}
+		
+		
 		std::optional<std::string_view> as_string() const noexcept {
 			if(tag_.type() != value_type::string)
 				return std::nullopt;
@@ -405,6 +1436,54 @@ namespace jessy {
 				return std::nullopt;
 			return {object{tag_.length(), this + 1, this + data_.count + 1}};
 		}
+		
+	private:
+	
+		std::optional<std::int64_t> text_to_int() const noexcept {
+			auto result = std::int64_t(0);
+			if(!detail::parse_int(data_.text, data_.text + tag_.length(), result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		std::optional<std::uint64_t> text_to_uint() const noexcept {
+			auto result = std::uint64_t(0);
+			if(!detail::parse_uint(data_.text, data_.text + tag_.length(), result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		bool decode_number() noexcept {
+			auto const* first = data_.text;
+			auto const* last = first + tag_.length();
+			if(is_integer()) {
+				if(auto const integer = text_to_int(); integer) {
+					data_.integer = *integer;
+					tag_.flags(tag_.flags() | decoded_int);
+					return true;
+				}
+				if(auto const uinteger = text_to_uint(); uinteger) {
+					data_.uinteger = *uinteger;
+					tag_.flags(tag_.flags() | decoded_uint);
+					return true;
+				}
+			}
+			auto real = 0.0;
+			if(!detail::parse_double(first, last, real))
+				return false;
+			// double is decoded only when its decimal form fits payload, other numbers stay text
+			auto significand = std::uint64_t(0);
+			auto fraction_digits = 0u;
+			if(value_tag::aux_bits == 0
+			   || !detail::parse_decimal_parts(first, last, significand, fraction_digits))
+				return true;
+			data_.real = real;
+			tag_.payload((significand << fraction_digits_bits) | fraction_digits);
+			tag_.flags(tag_.flags() | decoded_double);
+			return true;
+		}
 						
 	}; // value
 	
@@ -412,6 +1491,121 @@ namespace jessy {
 	inline constexpr value value::null;
 	
 	
+	// caches member position of the name for objects of the same shape,
+	// find updates the cache, so field_ref belongs to one parser and one thread
+	class field_ref {
+		std::string_view name_;
+		value_tag::size_type payload_;
+		value_tag::size_type shape_{0};
+		value_tag::size_type member_{0};
+		
+	public:
+	
+		explicit field_ref(std::string_view name) noexcept
+		: name_{name}, payload_{value::key_payload(name)} { }
+		
+		
+		std::string_view name() const noexcept {
+			return name_;
+		}
+		
+		
+		value::object::const_iterator find(value::object const& object) noexcept {
+			auto const shape = object.shape();
+			if(shape != 0 && shape == shape_ && member_ < object.size()) {
+				auto const* key = object.member(member_);
+				if(key->is_key(payload_, name_))
+					return value::object::const_iterator{key};
+			}
+			auto member = value_tag::size_type(0);
+			for(auto const* key = object.begin_; key != object.end_; key = value::next_of(key + 1)) {
+				if(key->is_key(payload_, name_)) {
+					shape_ = shape;
+					member_ = member;
+					return value::object::const_iterator{key};
+				}
+				++member;
+			}
+			return object.end();
+		}
+		
+	}; // field_ref
+	
+	
+	// Keys is a static array of std::string_view, handlers are called in the same order
+	template<auto const& Keys>
+	class dispatcher {
+		static constexpr auto size = sizeof(Keys) / sizeof(Keys[0]);
+		static constexpr auto hash = detail::make_perfect_hash(Keys);
+		
+	public:
+	
+		template<typename... Handlers>
+		static value::size_type walk(value::object const& object, Handlers&&... handlers) {
+			static_assert(sizeof...(Handlers) == size, "Handler should be provided for every key");
+			auto dispatched = value::size_type(0);
+			for(auto const* key = object.begin_; key != object.end_; key = value::next_of(key + 1)) {
+				auto const n = index_of(key);
+				if(n == size)
+					continue;
+				invoke(n, key[1], std::make_index_sequence<size>{}, handlers...);
+				++dispatched;
+			}
+			return dispatched;
+		}
+		
+		
+		// index of name in Keys or number of keys when it is absent
+		static std::size_t index_of(std::string_view name) noexcept {
+			auto const signature = detail::key_hash(name);
+			auto const payload = value_tag::payload(name.size(), signature);
+			if constexpr(hash.found) {
+				auto const slot = hash.slots[hash.slot_of(signature & detail::key_signature_mask)];
+				if(slot != 0 && hash.payloads[slot - 1] == payload && Keys[slot - 1] == name)
+					return slot - 1;
+				return size;
+			} else {
+				for(auto i = std::size_t(0); i != size; ++i)
+					if(hash.payloads[i] == payload && Keys[i] == name)
+						return i;
+				return size;
+			}
+		}
+		
+	private:
+	
+		static std::size_t index_of(value const* key) noexcept {
+			if constexpr(hash.found) {
+				auto const slot = hash.slots[hash.slot_of(key->key_signature())];
+				if(slot != 0 && key->is_key(hash.payloads[slot - 1], Keys[slot - 1]))
+					return slot - 1;
+				return size;
+			} else {
+				for(auto i = std::size_t(0); i != size; ++i)
+					if(key->is_key(hash.payloads[i], Keys[i]))
+						return i;
+				return size;
+			}
+		}
+		
+		
+		template<std::size_t... I, typename... Handlers>
+		static void invoke(std::size_t n,
+		                   value const& v,
+		                   std::index_sequence<I...>,
+		                   Handlers&... handlers) {
+			((n == I ? (void)handlers(v) : (void)0), ...);
+		}
+		
+	}; // dispatcher
+	
+	
+	template<auto const& Keys, typename... Handlers>
+	value::size_type dispatch(value::object const& object, Handlers&&... handlers) {
+		return dispatcher<Keys>::walk(object, std::forward<Handlers>(handlers)...);
+	}
+	
+	
 	enum result {
 		ok,
 		incomplete_json,
@@ -419,7 +1613,12 @@ namespace jessy {
 		number_is_out_of_range,
 		invalid_number,
 		unclosed_string,
-		invalid_escape_sequence
+		invalid_escape_sequence,
+		type_mismatch,
+		missing_field,
+		depth_exceeded,
+		capacity_exceeded,
+		length_exceeded
 	}; // result
 	
 	
@@ -439,31 +1638,1503 @@ namespace jessy {
 				return "Unclosed string";
 			case result::invalid_escape_sequence:
 				return "Invalid escape sequence";
+			case result::type_mismatch:
+				return "Type mismatch";
+			case result::missing_field:
+				return "Missing field";
+			case result::depth_exceeded:
+				return "Depth exceeded";
+			case result::capacity_exceeded:
+				return "Capacity exceeded";
+			case result::length_exceeded:
+				return "Length exceeded";
 			default:
 				return "Unknown";			
 		}
 	}
 	
 	
-	class parser {
-		
-		std::string buffer_;
-		std::vector<value> values_;
-		char* cursor_{nullptr};
+	// specialize with `fields` tuple of jessy::field for structs
+	// or with `names` array of name and value pairs for enums read from strings
+	template<typename T>
+	struct binding { };
+	
+	
+	template<typename T, typename M>
+	struct field_binding {
+		using member_type = M;
 		
-	public:
+		std::string_view name;
+		M T::* member;
+	}; // field_binding
 	
-		using size_type = std::size_t;
 	
-		parser() = default;
-		parser(parser const&) = default;
-		parser& operator = (parser const&) = default;
-		parser(parser&&) = default;
-		parser& operator = (parser&&) = default;
+	template<typename T, typename M>
+	constexpr field_binding<T, M> field(std::string_view name, M T::* member) noexcept {
+		return field_binding<T, M>{name, member};
+	}
+	
+	
+	namespace detail {
+	
+	
+		template<typename T, typename = void>
+		struct has_fields: std::false_type { };
 		
+		template<typename T>
+		struct has_fields<T, std::void_t<decltype(binding<T>::fields)>>: std::true_type { };
 		
-		explicit parser(size_type reserve_tokens, size_type buffer_size) {
-			values_.reserve(reserve_tokens);
+		
+		template<typename T, typename = void>
+		struct has_names: std::false_type { };
+		
+		template<typename T>
+		struct has_names<T, std::void_t<decltype(binding<T>::names)>>: std::true_type { };
+		
+		
+		template<typename T>
+		struct is_optional: std::false_type { };
+		
+		template<typename T>
+		struct is_optional<std::optional<T>>: std::true_type { };
+		
+		
+		template<typename T>
+		struct is_vector: std::false_type { };
+		
+		template<typename T, typename A>
+		struct is_vector<std::vector<T, A>>: std::true_type { };
+		
+		
+		template<typename T>
+		using fields_of = std::remove_const_t<decltype(binding<T>::fields)>;
+		
+		
+		template<typename T, typename = std::make_index_sequence<std::tuple_size_v<fields_of<T>>>>
+		struct field_names;
+		
+		template<typename T, std::size_t... I>
+		struct field_names<T, std::index_sequence<I...>> {
+			static constexpr std::string_view value[] = {std::get<I>(binding<T>::fields).name...};
+		}; // field_names
+		
+		
+	} // namespace detail
+	
+	
+	template<typename T>
+	result read(value const& v, T& out);
+	
+	
+	namespace detail {
+	
+	
+		template<typename T, std::size_t... I>
+		constexpr bool has_required_fields(bool const* seen, std::index_sequence<I...>) noexcept {
+			return ((seen[I]
+				|| is_optional<typename std::tuple_element_t<I, fields_of<T>>::member_type>::value) && ...);
+		}
+		
+		
+		template<std::size_t I, typename T>
+		void reset_if_absent(bool seen, T& out) {
+			using member_type = typename std::tuple_element_t<I, fields_of<T>>::member_type;
+			if constexpr(is_optional<member_type>::value)
+				if(!seen)
+					(out.*std::get<I>(binding<T>::fields).member).reset();
+		}
+		
+		
+		// optional members absent from object are reset, so reused structs keep nothing stale
+		template<typename T, std::size_t... I>
+		void reset_absent_fields(bool const* seen, T& out, std::index_sequence<I...>) {
+			(reset_if_absent<I>(seen[I], out), ...);
+		}
+		
+		
+		template<typename T, std::size_t... I>
+		result read_fields(value::object const& object, T& out, std::index_sequence<I...>) {
+			constexpr auto& fields = binding<T>::fields;
+			auto error = result::ok;
+			bool seen[sizeof...(I)]{};
+			dispatcher<field_names<T>::value>::walk(object, [&](value const& v) {
+				seen[I] = true;
+				if(error == result::ok)
+					error = read(v, out.*std::get<I>(fields).member);
+			}...);
+			if(error != result::ok)
+				return error;
+			reset_absent_fields(seen, out, std::index_sequence<I...>{});
+			if(!has_required_fields<T>(seen, std::index_sequence<I...>{}))
+				return result::missing_field;
+			return result::ok;
+		}
+		
+		
+	} // namespace detail
+	
+	
+	// fills out from v in one pass over object members, string_view members refer to parsed text
+	template<typename T>
+	result read(value const& v, T& out) {
+		if constexpr(std::is_same_v<T, bool>) {
+			auto const maybe = v.as_bool();
+			if(!maybe)
+				return result::type_mismatch;
+			out = *maybe;
+			return result::ok;
+		} else if constexpr(std::is_enum_v<T>) {
+			if constexpr(detail::has_names<T>::value) {
+				auto const maybe = v.as_string();
+				if(!maybe)
+					return result::type_mismatch;
+				for(auto const& [name, each]: binding<T>::names)
+					if(name == *maybe) {
+						out = each;
+						return result::ok;
+					}
+				return result::type_mismatch;
+			} else {
+				auto underlying = std::underlying_type_t<T>{};
+				auto const e = read(v, underlying);
+				if(e == result::ok)
+					out = T(underlying);
+				return e;
+			}
+		} else if constexpr(std::is_integral_v<T>) {
+			if(!v.is_integer())
+				return result::type_mismatch;
+			if constexpr(std::is_signed_v<T>) {
+				auto const maybe = v.as_int();
+				if(!maybe || *maybe < std::int64_t(std::numeric_limits<T>::min())
+				   || *maybe > std::int64_t(std::numeric_limits<T>::max()))
+					return result::number_is_out_of_range;
+				out = T(*maybe);
+			} else {
+				auto const maybe = v.as_uint();
+				if(!maybe || *maybe > std::uint64_t(std::numeric_limits<T>::max()))
+					return result::number_is_out_of_range;
+				out = T(*maybe);
+			}
+			return result::ok;
+		} else if constexpr(std::is_floating_point_v<T>) {
+			if(v.type() != value_type::number)
+				return result::type_mismatch;
+			auto const maybe = v.as_double();
+			if(!maybe)
+				return result::number_is_out_of_range;
+			out = T(*maybe);
+			return result::ok;
+		} else if constexpr(std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>) {
+			auto const maybe = v.as_string();
+			if(!maybe)
+				return result::type_mismatch;
+			out = T{*maybe};
+			return result::ok;
+		} else if constexpr(detail::is_optional<T>::value) {
+			if(v.is_null()) {
+				out.reset();
+				return result::ok;
+			}
+			return read(v, out.emplace());
+		} else if constexpr(detail::is_vector<T>::value) {
+			auto const maybe = v.as_array();
+			if(!maybe)
+				return result::type_mismatch;
+			out.clear();
+			out.reserve(maybe->size());
+			for(auto const& each: *maybe) {
+				auto const e = read(each, out.emplace_back());
+				if(e != result::ok)
+					return e;
+			}
+			return result::ok;
+		} else {
+			static_assert(detail::has_fields<T>::value, "jessy::binding<T>::fields is not specialized");
+			auto const maybe = v.as_object();
+			if(!maybe)
+				return result::type_mismatch;
+			return detail::read_fields(*maybe, out,
+				std::make_index_sequence<std::tuple_size_v<detail::fields_of<T>>>{});
+		}
+	}
+	
+	
+	// set of wanted paths like "/legs/symbol", arrays are transparent
+	class projection {
+	friend class parser;
+	
+		static constexpr std::uint32_t none = std::uint32_t(-1);
+		
+		// members of node are linked through next, names are kept in names_
+		struct member {
+			value_tag::size_type payload;
+			std::uint32_t name;
+			std::uint32_t size;
+			std::uint32_t node;
+			std::uint32_t next;
+		}; // member
+		
+		struct node {
+			std::uint32_t first{none};
+			bool whole{false};
+		}; // node
+		
+		detail::vector<node> nodes_;
+		detail::vector<member> members_;
+		detail::string names_;
+		
+	public:
+	
+		projection() {
+			nodes_.emplace_back();
+		}
+		
+		
+#if JESSY_PMR
+		explicit projection(std::pmr::memory_resource* resource)
+		: nodes_(resource), members_(resource), names_(resource) {
+			nodes_.emplace_back();
+		}
+#endif
+		
+		
+		projection(std::initializer_list<std::string_view> paths)
+		: projection{} {
+			for(auto const path: paths)
+				add(path);
+		}
+		
+		
+		// JSON pointer without array indices, empty path selects everything
+		projection& add(std::string_view path) {
+			auto current = std::uint32_t(0);
+			while(!path.empty() && !nodes_[current].whole) {
+				if(path.front() == '/')
+					path.remove_prefix(1);
+				auto const end = path.find('/');
+				auto const offset = names_.size();
+				unescape(path.substr(0, end));
+				path.remove_prefix(end == std::string_view::npos ? path.size() : end);
+				auto const name = std::string_view{names_.data() + offset, names_.size() - offset};
+				auto const payload = value_tag::payload(name.size(), detail::key_hash(name));
+				auto next = find(current, payload, name);
+				if(next == none) {
+					next = std::uint32_t(nodes_.size());
+					members_.push_back({payload, std::uint32_t(offset), std::uint32_t(name.size()),
+					                    next, nodes_[current].first});
+					nodes_[current].first = std::uint32_t(members_.size() - 1);
+					nodes_.emplace_back();
+				} else
+					names_.resize(offset);
+				current = next;
+			}
+			nodes_[current].whole = true;
+			return *this;
+		}
+		
+	private:
+	
+		// appends token to names_ with ~0 and ~1 replaced
+		void unescape(std::string_view token) {
+			names_.reserve(names_.size() + token.size());
+			for(auto i = std::size_t(0); i != token.size(); ++i)
+				if(token[i] == '~' && i + 1 != token.size() && (token[i + 1] == '0' || token[i + 1] == '1'))
+					names_ += token[++i] == '0' ? '~' : '/';
+				else
+					names_ += token[i];
+		}
+		
+		
+		std::uint32_t find(std::uint32_t current,
+		                   value_tag::size_type payload,
+		                   std::string_view name) const noexcept {
+			for(auto i = nodes_[current].first; i != none; i = members_[i].next) {
+				auto const& each = members_[i];
+				if(each.payload == payload && std::string_view{names_.data() + each.name, each.size} == name)
+					return each.node;
+			}
+			return none;
+		}
+		
+	}; // projection
+	
+	
+	struct options {
+		bool decode_numbers{false};
+		bool cache_shapes{false};
+		std::size_t max_depth{1024};
+		std::size_t max_shapes{4096};
+	}; // options
+	
+	
+	namespace detail {
+	
+	
+		using scan_kernel = std::size_t (*)(char const*) noexcept;
+		using copy_kernel = std::size_t (*)(char*, char const*) noexcept;
+		
+		enum class simd_level: std::uint8_t {
+			scalar, sse2, sse42, avx2, avx512
+		}; // simd_level
+		
+		struct kernels {
+			scan_kernel count_whitespace;
+			scan_kernel count_plain;
+			copy_kernel copy_plain;
+		}; // kernels
+		
+		
+		inline bool is_whitespace(char c) noexcept {
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+		}
+		
+		
+		inline bool is_string_special(char c) noexcept {
+			return c == '"' || c == '\\' || std::uint8_t(c) < 0x20;
+		}
+		
+		
+		inline std::size_t count_whitespace_scalar(char const* p) noexcept {
+			auto const* it = p;
+			while(is_whitespace(*it))
+				++it;
+			return std::size_t(it - p);
+		}
+		
+		
+		inline std::size_t count_plain_scalar(char const* p) noexcept {
+			auto const* it = p;
+			while(!is_string_special(*it))
+				++it;
+			return std::size_t(it - p);
+		}
+
+		
+		inline std::size_t copy_plain_scalar(char* dst, char const* src) noexcept {
+			auto n = std::size_t(0);
+			while(!is_string_special(src[n])) {
+				dst[n] = src[n];
+				++n;
+			}
+			return n;
+		}
+		
+		
+		inline unsigned trailing_zeros64(std::uint64_t word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+			unsigned long index;
+			_BitScanForward64(&index, word);
+			return unsigned(index);
+#elif defined(_MSC_VER) && !defined(__clang__)
+			auto n = 0u;
+			for(; (word & 1) == 0; word >>= 1)
+				++n;
+			return n;
+#else
+			return unsigned(__builtin_ctzll(word));
+#endif
+		}
+		
+		
+#if defined(JESSY_X86)
+
+		inline unsigned trailing_zeros(std::uint32_t mask) noexcept {
+#	if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return unsigned(index);
+#	else
+			return unsigned(__builtin_ctz(mask));
+#	endif
+		}
+		
+		
+		JESSY_TARGET("sse2")
+		inline std::size_t count_whitespace_sse2(char const* p) noexcept {
+			auto const space = _mm_set1_epi8(' ');
+			auto const lf = _mm_set1_epi8('\n');
+			auto const cr = _mm_set1_epi8('\r');
+			auto const tab = _mm_set1_epi8('\t');
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(it));
+				auto const ws = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, lf)),
+					_mm_or_si128(_mm_cmpeq_epi8(block, cr), _mm_cmpeq_epi8(block, tab)));
+				auto const mask = std::uint32_t(_mm_movemask_epi8(ws)) ^ 0xFFFFu;
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros(mask);
+				it += 16;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx2")
+		inline std::size_t count_whitespace_avx2(char const* p) noexcept {
+			auto const space = _mm256_set1_epi8(' ');
+			auto const lf = _mm256_set1_epi8('\n');
+			auto const cr = _mm256_set1_epi8('\r');
+			auto const tab = _mm256_set1_epi8('\t');
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(it));
+				auto const ws = _mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(block, space), _mm256_cmpeq_epi8(block, lf)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(block, cr), _mm256_cmpeq_epi8(block, tab)));
+				auto const mask = ~std::uint32_t(_mm256_movemask_epi8(ws));
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros(mask);
+				it += 32;
+			}
+		}
+		
+		
+		JESSY_TARGET("sse2")
+		inline std::size_t count_plain_sse2(char const* p) noexcept {
+			auto const quote = _mm_set1_epi8('"');
+			auto const backslash = _mm_set1_epi8('\\');
+			auto const control = _mm_set1_epi8(0x1F);
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(it));
+				auto const specials = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)),
+					_mm_cmpeq_epi8(_mm_min_epu8(block, control), block));
+				auto const mask = std::uint32_t(_mm_movemask_epi8(specials));
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros(mask);
+				it += 16;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx2")
+		inline std::size_t count_plain_avx2(char const* p) noexcept {
+			auto const quote = _mm256_set1_epi8('"');
+			auto const backslash = _mm256_set1_epi8('\\');
+			auto const control = _mm256_set1_epi8(0x1F);
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(it));
+				auto const specials = _mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)),
+					_mm256_cmpeq_epi8(_mm256_min_epu8(block, control), block));
+				auto const mask = std::uint32_t(_mm256_movemask_epi8(specials));
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros(mask);
+				it += 32;
+			}
+		}
+		
+		
+		// dst is behind src, so only completely plain blocks are stored at once
+		JESSY_TARGET("sse2")
+		inline std::size_t copy_plain_sse2(char* dst, char const* src) noexcept {
+			auto const quote = _mm_set1_epi8('"');
+			auto const backslash = _mm_set1_epi8('\\');
+			auto const control = _mm_set1_epi8(0x1F);
+			auto n = std::size_t(0);
+			for(;;) {
+				auto const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + n));
+				auto const specials = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)),
+					_mm_cmpeq_epi8(_mm_min_epu8(block, control), block));
+				auto const mask = std::uint32_t(_mm_movemask_epi8(specials));
+				if(mask != 0) {
+					auto const tail = n + trailing_zeros(mask);
+					for(; n != tail; ++n)
+						dst[n] = src[n];
+					return n;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n), block);
+				n += 16;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx2")
+		inline std::size_t copy_plain_avx2(char* dst, char const* src) noexcept {
+			auto const quote = _mm256_set1_epi8('"');
+			auto const backslash = _mm256_set1_epi8('\\');
+			auto const control = _mm256_set1_epi8(0x1F);
+			auto n = std::size_t(0);
+			for(;;) {
+				auto const block = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + n));
+				auto const specials = _mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)),
+					_mm256_cmpeq_epi8(_mm256_min_epu8(block, control), block));
+				auto const mask = std::uint32_t(_mm256_movemask_epi8(specials));
+				if(mask != 0) {
+					auto const tail = n + trailing_zeros(mask);
+					for(; n != tail; ++n)
+						dst[n] = src[n];
+					return n;
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n), block);
+				n += 32;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx512f,avx512bw")
+		inline std::size_t count_whitespace_avx512(char const* p) noexcept {
+			auto const space = _mm512_set1_epi8(' ');
+			auto const lf = _mm512_set1_epi8('\n');
+			auto const cr = _mm512_set1_epi8('\r');
+			auto const tab = _mm512_set1_epi8('\t');
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm512_loadu_si512(it);
+				auto const ws = _mm512_cmpeq_epi8_mask(block, space) | _mm512_cmpeq_epi8_mask(block, lf)
+					| _mm512_cmpeq_epi8_mask(block, cr) | _mm512_cmpeq_epi8_mask(block, tab);
+				auto const mask = ~std::uint64_t(ws);
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros64(mask);
+				it += 64;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx512f,avx512bw")
+		inline std::size_t count_plain_avx512(char const* p) noexcept {
+			auto const quote = _mm512_set1_epi8('"');
+			auto const backslash = _mm512_set1_epi8('\\');
+			auto const control = _mm512_set1_epi8(0x1F);
+			auto const* it = p;
+			for(;;) {
+				auto const block = _mm512_loadu_si512(it);
+				auto const mask = std::uint64_t(_mm512_cmpeq_epi8_mask(block, quote)
+					| _mm512_cmpeq_epi8_mask(block, backslash)
+					| _mm512_cmple_epu8_mask(block, control));
+				if(mask != 0)
+					return std::size_t(it - p) + trailing_zeros64(mask);
+				it += 64;
+			}
+		}
+		
+		
+		JESSY_TARGET("avx512f,avx512bw")
+		inline std::size_t copy_plain_avx512(char* dst, char const* src) noexcept {
+			auto const quote = _mm512_set1_epi8('"');
+			auto const backslash = _mm512_set1_epi8('\\');
+			auto const control = _mm512_set1_epi8(0x1F);
+			auto n = std::size_t(0);
+			for(;;) {
+				auto const block = _mm512_loadu_si512(src + n);
+				auto const mask = std::uint64_t(_mm512_cmpeq_epi8_mask(block, quote)
+					| _mm512_cmpeq_epi8_mask(block, backslash)
+					| _mm512_cmple_epu8_mask(block, control));
+				if(mask != 0) {
+					auto const tail = n + trailing_zeros64(mask);
+					for(; n != tail; ++n)
+						dst[n] = src[n];
+					return n;
+				}
+				_mm512_storeu_si512(dst + n, block);
+				n += 64;
+			}
+		}
+		
+		
+		inline simd_level cpu_simd_level() noexcept {
+#	if defined(_MSC_VER) && !defined(__clang__)
+			int info[4];
+			__cpuid(info, 0);
+			auto const leaves = info[0];
+			__cpuid(info, 1);
+			if((info[3] & (1 << 26)) == 0)
+				return simd_level::scalar;
+			auto const sse42 = (info[2] & (1 << 20)) != 0;
+			auto const osxsave_avx = (1 << 27) | (1 << 28);
+			if(leaves < 7 || (info[2] & osxsave_avx) != osxsave_avx)
+				return sse42 ? simd_level::sse42 : simd_level::sse2;
+			auto const xcr0 = _xgetbv(0);
+			if((xcr0 & 0x6) != 0x6)
+				return sse42 ? simd_level::sse42 : simd_level::sse2;
+			__cpuidex(info, 7, 0);
+			auto const avx512 = (1 << 16) | (1 << 30);
+			if((info[1] & avx512) == avx512 && (xcr0 & 0xE6) == 0xE6)
+				return simd_level::avx512;
+			if((info[1] & (1 << 5)) != 0)
+				return simd_level::avx2;
+			return sse42 ? simd_level::sse42 : simd_level::sse2;
+#	else
+			__builtin_cpu_init();
+			if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+				return simd_level::avx512;
+			if(__builtin_cpu_supports("avx2"))
+				return simd_level::avx2;
+			if(__builtin_cpu_supports("sse4.2"))
+				return simd_level::sse42;
+			if(__builtin_cpu_supports("sse2"))
+				return simd_level::sse2;
+			return simd_level::scalar;
+#	endif
+		}
+		
+#else
+
+		inline simd_level cpu_simd_level() noexcept {
+			return simd_level::scalar;
+		}
+
+#endif // JESSY_X86
+
+
+		// highest level supported by both CPU and JESSY_SIMD_LEVEL
+		inline simd_level detect_simd_level() noexcept {
+			auto const level = cpu_simd_level();
+#if defined(JESSY_SIMD_LEVEL)
+			if(simd_level(JESSY_SIMD_LEVEL) < level)
+				return simd_level(JESSY_SIMD_LEVEL);
+#endif
+			return level;
+		}
+		
+		
+		// there are no SSE4.2 specific kernels, SSE2 ones are used instead
+		inline kernels kernels_for(simd_level level) noexcept {
+			switch(level) {
+#if defined(JESSY_X86)
+				case simd_level::avx512:
+					return {&count_whitespace_avx512, &count_plain_avx512, &copy_plain_avx512};
+				case simd_level::avx2:
+					return {&count_whitespace_avx2, &count_plain_avx2, &copy_plain_avx2};
+				case simd_level::sse42:
+				case simd_level::sse2:
+					return {&count_whitespace_sse2, &count_plain_sse2, &copy_plain_sse2};
+#endif
+				default:
+					return {&count_whitespace_scalar, &count_plain_scalar, &copy_plain_scalar};
+			}
+		}
+		
+		
+		// selected once on first use
+		inline kernels const& active_kernels() noexcept {
+			static kernels const selected = kernels_for(detect_simd_level());
+			return selected;
+		}
+		
+		
+		// p should be followed by a non-whitespace character within readable padding
+		inline std::size_t count_whitespace(char const* p) noexcept {
+			return active_kernels().count_whitespace(p);
+		}
+		
+		
+		// number of leading characters which are not quote, backslash or control one
+		inline std::size_t count_plain(char const* p) noexcept {
+			return active_kernels().count_plain(p);
+		}
+		
+		
+		// moves leading plain characters from src to dst, dst should not be ahead of src
+		inline std::size_t copy_plain(char* dst, char const* src) noexcept {
+			return active_kernels().copy_plain(dst, src);
+		}
+		
+		
+	} // namespace detail
+	
+	
+	// parsed values owning their text, detached from parser
+	class document {
+	friend class parser;
+	
+		detail::string buffer_;
+		detail::vector<value> values_;
+		
+	public:
+		using size_type = std::size_t;
+		
+		document() = default;
+		
+		
+#if JESSY_PMR
+		explicit document(std::pmr::memory_resource* resource)
+		: buffer_(resource), values_(resource) { }
+#endif
+		
+		
+		document(document const& other)
+		: buffer_{other.buffer_}, values_{other.values_} {
+			value::rebase(values_.data(), values_.data() + values_.size(),
+			              other.buffer_.data(), buffer_.data(), buffer_.size());
+		}
+		
+		
+		document& operator = (document const& other) {
+			if(this != &other)
+				*this = document{other};
+			return *this;
+		}
+		
+		
+		document(document&& other) noexcept
+		: document{std::move(other), other.buffer_.data()} { }
+		
+		
+		// copies text when resources differ
+		document& operator = (document&& other) {
+			auto const* const from = other.buffer_.data();
+			buffer_ = std::move(other.buffer_);
+			values_ = std::move(other.values_);
+			value::rebase(values_.data(), values_.data() + values_.size(),
+			              from, buffer_.data(), buffer_.size());
+			return *this;
+		}
+		
+		
+		value const* root() const noexcept {
+			if(values_.empty())
+				return &value::null;
+			return &values_.front();
+		}
+		
+		
+		bool empty() const noexcept {
+			return values_.empty();
+		}
+		
+		
+		// keeps storage for next use
+		void clear() noexcept {
+			buffer_.clear();
+			values_.clear();
+		}
+		
+		
+#if JESSY_PMR
+		std::pmr::memory_resource* resource() const noexcept {
+			return values_.get_allocator().resource();
+		}
+#endif
+		
+	private:
+	
+		document(document&& other, char const* from) noexcept
+		: buffer_(std::move(other.buffer_)), values_(std::move(other.values_)) {
+			value::rebase(values_.data(), values_.data() + values_.size(),
+			              from, buffer_.data(), buffer_.size());
+		}
+		
+	}; // document
+	
+	
+	// recycles storage of documents released by any thread
+	class document_pool {
+	
+		std::mutex mutex_;
+#if JESSY_PMR
+		std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};
+#endif
+		detail::vector<document> free_;
+		
+	public:
+		using size_type = std::size_t;
+		
+		document_pool() = default;
+		
+#if JESSY_PMR
+		// resource should be thread-safe when documents are released by other threads
+		explicit document_pool(std::pmr::memory_resource* resource)
+		: resource_{resource}, free_(resource) { }
+#endif
+		
+		
+		document acquire() {
+			auto const lock = std::lock_guard<std::mutex>{mutex_};
+#if JESSY_PMR
+			if(free_.empty())
+				return document{resource_};
+#else
+			if(free_.empty())
+				return document{};
+#endif
+			auto taken = std::move(free_.back());
+			free_.pop_back();
+			return taken;
+		}
+		
+		
+		void release(document&& used) {
+			used.clear();
+			auto const lock = std::lock_guard<std::mutex>{mutex_};
+			free_.push_back(std::move(used));
+		}
+		
+		
+		size_type size() {
+			auto const lock = std::lock_guard<std::mutex>{mutex_};
+			return free_.size();
+		}
+		
+	}; // document_pool
+	
+	
+	// type, number flags and length in head, offset of text or count of nested nodes
+	struct compact_node {
+		static constexpr unsigned type_shift = 29;
+		static constexpr unsigned flags_shift = 25;
+		static constexpr std::uint32_t length_mask = (std::uint32_t(1) << flags_shift) - 1;
+		
+		std::uint32_t head;
+		std::uint32_t offset;
+		
+		static constexpr compact_node make(value_type type,
+		                                   std::size_t length = 0,
+		                                   std::size_t offset = 0,
+		                                   std::size_t flags = 0) noexcept {
+			return compact_node{(std::uint32_t(type) << type_shift)
+			                        | (std::uint32_t(flags) << flags_shift)
+			                        | std::uint32_t(length),
+			                    std::uint32_t(offset)};
+		}
+		
+		
+		constexpr value_type type() const noexcept {
+			return value_type(head >> type_shift);
+		}
+		
+		
+		constexpr std::uint32_t flags() const noexcept {
+			return (head >> flags_shift) & 0xF;
+		}
+		
+		
+		constexpr std::uint32_t length() const noexcept {
+			return head & length_mask;
+		}
+		
+		
+		constexpr compact_node const* next() const noexcept {
+			switch(type()) {
+				case value_type::array:
+				case value_type::object:
+					return this + offset + 1;
+				default:
+					return this + 1;
+			}
+		}
+		
+	}; // compact_node
+	
+	static_assert(sizeof(compact_node) == 8, "Invalid compact node size");
+	
+	
+	// view of compact node, accessors are those of jessy::value
+	class compact_value {
+	friend class compact_document;
+	
+		char const* text_;
+		compact_node const* node_;
+		
+		constexpr compact_value(char const* text, compact_node const* node) noexcept
+		: text_{text}, node_{node} { }
+		
+	public:
+		using size_type = std::size_t;
+		
+		class array {
+		friend class compact_value;
+		
+			char const* text_;
+			compact_node const* begin_;
+			compact_node const* end_;
+			size_type length_;
+			
+		public:
+		
+			class const_iterator {
+			friend class array;
+			
+				char const* text_;
+				compact_node const* it_;
+				
+			public:
+			
+				bool operator == (const_iterator const& other) const noexcept {
+					return it_ == other.it_;
+				}
+				
+				
+				bool operator != (const_iterator const& other) const noexcept {
+					return it_ != other.it_;
+				}
+				
+				
+				compact_value operator * () const noexcept {
+					return compact_value{text_, it_};
+				}
+				
+				
+				const_iterator& operator ++ () noexcept {
+					it_ = it_->next();
+					return *this;
+				}
+				
+				
+				const_iterator operator ++ (int) noexcept {
+					auto const me{*this};
+					++(*this);
+					return me;
+				}
+				
+			private:
+			
+				const_iterator(char const* text, compact_node const* it) noexcept
+				: text_{text}, it_{it} { }
+				
+			}; // const_iterator
+			
+			size_type size() const noexcept { return length_; }
+			bool empty() const noexcept { return begin_ == end_; }
+			
+			const_iterator begin() const noexcept {
+				return const_iterator{text_, begin_};
+			}
+			
+			
+			const_iterator end() const noexcept {
+				return const_iterator{text_, end_};
+			}
+			
+		private:
+		
+			array(char const* text,
+			      compact_node const* begin,
+			      compact_node const* end,
+			      size_type length) noexcept
+			: text_{text}, begin_{begin}, end_{end}, length_{length} { }
+			
+		}; // array
+		
+		class object {
+		friend class compact_value;
+		
+			char const* text_;
+			compact_node const* begin_;
+			compact_node const* end_;
+			size_type length_;
+			
+		public:
+		
+			class const_iterator {
+			friend class object;
+			
+				char const* text_;
+				compact_node const* key_;
+				
+			public:
+			
+				bool operator == (const_iterator const& other) const noexcept {
+					return key_ == other.key_;
+				}
+				
+				
+				bool operator != (const_iterator const& other) const noexcept {
+					return key_ != other.key_;
+				}
+				
+				
+				std::string_view key() const noexcept {
+					return std::string_view{text_ + key_->offset, key_->length()};
+				}
+				
+				
+				compact_value operator * () const noexcept {
+					return compact_value{text_, key_ + 1};
+				}
+				
+				
+				const_iterator& operator ++ () noexcept {
+					key_ = (key_ + 1)->next();
+					return *this;
+				}
+				
+				
+				const_iterator operator ++ (int) noexcept {
+					auto const me{*this};
+					++(*this);
+					return me;
+				}
+				
+			private:
+			
+				const_iterator(char const* text, compact_node const* key) noexcept
+				: text_{text}, key_{key} { }
+				
+			}; // const_iterator
+			
+			size_type size() const noexcept { return length_; }
+			bool empty() const noexcept { return begin_ == end_; }
+			
+			const_iterator begin() const noexcept {
+				return const_iterator{text_, begin_};
+			}
+			
+			
+			const_iterator end() const noexcept {
+				return const_iterator{text_, end_};
+			}
+			
+			
+			const_iterator find(const_iterator from, std::string_view name) const noexcept {
+				auto const* it = from.key_;
+				while(it != end_) {
+					if(is_key(it, name))
+						return const_iterator{text_, it};
+					it = (it + 1)->next();
+				}
+				it = begin_;
+				while(it != from.key_) {
+					if(is_key(it, name))
+						return const_iterator{text_, it};
+					it = (it + 1)->next();
+				}
+				return end();
+			}
+			
+		private:
+		
+			object(char const* text,
+			       compact_node const* begin,
+			       compact_node const* end,
+			       size_type length) noexcept
+			: text_{text}, begin_{begin}, end_{end}, length_{length} { }
+			
+			
+			bool is_key(compact_node const* key, std::string_view name) const noexcept {
+				return key->length() == name.size()
+					&& std::string_view{text_ + key->offset, name.size()} == name;
+			}
+			
+		}; // object
+		
+		
+		value_type type() const noexcept {
+			return node_->type();
+		}
+		
+		
+		bool is_null() const noexcept { return type() == value_type::null; }
+		
+		
+		bool is_integer() const noexcept {
+			return type() == value_type::number
+				&& (node_->flags() & value::number_nonintegral) == 0;
+		}
+		
+		
+		bool is_float() const noexcept {
+			return type() == value_type::number
+				&& (node_->flags() & value::number_nonintegral) != 0;
+		}
+		
+		
+		std::optional<bool> as_bool() const noexcept {
+			if(type() != value_type::boolean)
+				return std::nullopt;
+			return {node_->length() != 0};
+		}
+		
+		
+		std::optional<std::int64_t> as_int() const noexcept {
+			auto result = std::int64_t(0);
+			if(!is_integer() || !detail::parse_int(first(), last(), result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		std::optional<std::uint64_t> as_uint() const noexcept {
+			auto result = std::uint64_t(0);
+			if(!is_integer() || !detail::parse_uint(first(), last(), result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		std::optional<double> as_double() const noexcept {
+			auto result = 0.0;
+			if(type() != value_type::number || !detail::parse_double(first(), last(), result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		std::optional<std::int64_t> as_decimal(unsigned scale,
+		                                       rounding mode = rounding::half_even) const noexcept {
+			auto result = std::int64_t(0);
+			if(type() != value_type::number
+			   || !detail::parse_decimal(first(), last(), scale, mode, result))
+				return std::nullopt;
+			return {result};
+		}
+		
+		
+		std::optional<std::string_view> as_string() const noexcept {
+			if(type() != value_type::string)
+				return std::nullopt;
+			return {std::string_view{first(), node_->length()}};
+		}
+		
+		
+		std::optional<array> as_array() const noexcept {
+			if(type() != value_type::array)
+				return std::nullopt;
+			return {array{text_, node_ + 1, node_ + node_->offset + 1, node_->length()}};
+		}
+		
+		
+		std::optional<object> as_object() const noexcept {
+			if(type() != value_type::object)
+				return std::nullopt;
+			return {object{text_, node_ + 1, node_ + node_->offset + 1, node_->length()}};
+		}
+		
+	private:
+	
+		char const* first() const noexcept {
+			return text_ + node_->offset;
+		}
+		
+		
+		char const* last() const noexcept {
+			return first() + node_->length();
+		}
+		
+	}; // compact_value
+	
+	
+	// values as 8-byte nodes filled by parser, numbers are kept as text and converted
+	// by accessors, text is owned when parsed from string_view and borrowed when parsed in place
+	class compact_document {
+	friend class parser;
+	
+		detail::string buffer_;
+		detail::vector<compact_node> nodes_;
+		char const* borrowed_{nullptr};
+		
+	public:
+		using size_type = std::size_t;
+		
+		static constexpr size_type max_length = compact_node::length_mask;
+		static constexpr size_type max_offset = std::numeric_limits<std::uint32_t>::max();
+		
+		compact_document() = default;
+		
+		
+#if JESSY_PMR
+		explicit compact_document(std::pmr::memory_resource* resource)
+		: buffer_(resource), nodes_(resource) { }
+#endif
+		
+		
+		compact_value root() const noexcept {
+			static constexpr compact_node null{0, 0};
+			if(nodes_.empty())
+				return compact_value{text(), &null};
+			return compact_value{text(), nodes_.data()};
+		}
+		
+		
+		size_type size() const noexcept {
+			return nodes_.size();
+		}
+		
+		
+		void clear() noexcept {
+			buffer_.clear();
+			nodes_.clear();
+			borrowed_ = nullptr;
+		}
+		
+		
+#if JESSY_PMR
+		std::pmr::memory_resource* resource() const noexcept {
+			return nodes_.get_allocator().resource();
+		}
+#endif
+		
+	private:
+	
+		char const* text() const noexcept {
+			return borrowed_ != nullptr ? borrowed_ : buffer_.data();
+		}
+		
+	}; // compact_document
+	
+	
+	class parser {
+		
+		struct object_index {
+			std::uint32_t object;
+			std::uint32_t mask;
+			std::size_t first;
+		}; // object_index
+		
+		struct object_shape {
+			std::uint64_t fingerprint;
+			std::size_t id;
+		}; // object_shape
+		
+		struct frame {
+			std::size_t index;
+			std::size_t length;
+			std::uint64_t fingerprint;
+			projection const* selected;
+			std::uint32_t wanted;
+			bool object;
+		}; // frame
+		
+		// values in own storage or in caller span, span is never grown
+		class tape {
+			detail::vector<value> owned_;
+			value* begin_{nullptr};
+			value* end_{nullptr};
+			value* limit_{nullptr};
+			bool fixed_{false};
+			
+		public:
+			tape() = default;
+			
+			
+#if JESSY_PMR
+			explicit tape(std::pmr::memory_resource* resource)
+			: owned_(resource) { }
+#endif
+			
+			
+			tape(tape const& other)
+			: owned_(other.begin_, other.end_) {
+				own(owned_.size());
+			}
+			
+			
+			tape& operator = (tape const& other) {
+				if(this != &other) {
+					owned_.assign(other.begin_, other.end_);
+					fixed_ = false;
+					own(owned_.size());
+				}
+				return *this;
+			}
+			
+			
+			tape(tape&& other) noexcept
+			: owned_(std::move(other.owned_)), fixed_{other.fixed_} {
+				take(other);
+			}
+			
+			
+			tape& operator = (tape&& other) {
+				owned_ = std::move(other.owned_);
+				fixed_ = other.fixed_;
+				take(other);
+				return *this;
+			}
+			
+			
+			std::size_t size() const noexcept { return std::size_t(end_ - begin_); }
+			bool empty() const noexcept { return end_ == begin_; }
+			value* data() noexcept { return begin_; }
+			value const* data() const noexcept { return begin_; }
+			value const* begin() const noexcept { return begin_; }
+			value const* end() const noexcept { return end_; }
+			value& operator [] (std::size_t i) noexcept { return begin_[i]; }
+			value const& front() const noexcept { return *begin_; }
+			bool fixed() const noexcept { return fixed_; }
+			void clear() noexcept { end_ = begin_; }
+			
+			
+#if JESSY_PMR
+			std::pmr::memory_resource* resource() const noexcept {
+				return owned_.get_allocator().resource();
+			}
+#endif
+			
+			
+			void reserve(std::size_t capacity) {
+				if(fixed_ || owned_.capacity() >= capacity)
+					return;
+				auto const size = this->size();
+				owned_.reserve(capacity);
+				own(size);
+			}
+			
+			
+			void use(value* values, std::size_t capacity) noexcept {
+				fixed_ = true;
+				begin_ = end_ = values;
+				limit_ = values + capacity;
+			}
+			
+			
+			void use_own() noexcept {
+				if(!fixed_)
+					return;
+				fixed_ = false;
+				own(0);
+			}
+			
+			
+			// null when span is full
+			template<typename... Args>
+			value* push(Args&&... args) {
+				if(end_ == limit_) {
+					if(fixed_)
+						return nullptr;
+					extend();
+				}
+				*end_ = value(std::forward<Args>(args)...);
+				return end_++;
+			}
+			
+			
+			// moves values to out, own storage is exchanged when resources are equal
+			void move_to(detail::vector<value>& out) {
+				if(!fixed_ && out.get_allocator() == owned_.get_allocator()) {
+					owned_.resize(size());
+					owned_.swap(out);
+					owned_.clear();
+					own(0);
+				} else {
+					out.assign(begin_, end_);
+					clear();
+				}
+			}
+			
+		private:
+		
+			void own(std::size_t size) noexcept {
+				begin_ = owned_.data();
+				end_ = begin_ + size;
+				limit_ = begin_ + owned_.size();
+			}
+			
+			
+			void take(tape& other) noexcept {
+				if(fixed_) {
+					begin_ = other.begin_;
+					end_ = other.end_;
+					limit_ = other.limit_;
+				} else
+					own(other.size());
+				other.fixed_ = false;
+				other.own(0);
+			}
+			
+			
+			// values are constructed in chunks ahead of end_, reserved capacity is not touched,
+			// so growth copies only constructed values
+			void extend() {
+				constexpr auto chunk = std::size_t(256);
+				auto const size = this->size();
+				if(owned_.size() == owned_.capacity())
+					owned_.reserve(owned_.capacity() < 16 ? 16 : owned_.capacity() * 2);
+				auto const available = owned_.capacity() - owned_.size();
+				owned_.resize(owned_.size() + (available < chunk ? available : chunk));
+				own(size);
+			}
+		}; // tape
+		
+		detail::string buffer_;
+		tape values_;
+		char* cursor_{nullptr};
+		options options_;
+		detail::vector<std::uint32_t> index_slots_;
+		detail::vector<object_index> indexes_;
+		std::size_t indexed_objects_{0};
+		detail::vector<object_shape> shapes_;
+		std::size_t shapes_count_{0};
+		std::size_t last_shape_{0};
+		projection const* projection_{nullptr};
+		std::uint32_t wanted_{0};
+		detail::vector<frame> frames_;
+		char* text_{nullptr};
+		
+	public:
+	
+		using size_type = std::size_t;
+		
+		static constexpr size_type padding = 64;
+		static constexpr size_type index_threshold = 16;
+		static constexpr size_type max_shape_id = (size_type(1) << value_tag::aux_bits) - 1;
+	
+		parser() = default;
+		// copies and moves keep values valid, text pointers are rebased onto own buffer
+		parser(parser const& other)
+		: buffer_{other.buffer_},
+		  values_{other.values_},
+		  cursor_{other.cursor_},
+		  options_{other.options_},
+		  index_slots_{other.index_slots_},
+		  indexes_{other.indexes_},
+		  indexed_objects_{other.indexed_objects_},
+		  shapes_{other.shapes_},
+		  shapes_count_{other.shapes_count_},
+		  last_shape_{other.last_shape_},
+		  text_{other.text_} {
+			rebase(other.buffer_.data());
+		}
+		
+		
+		parser& operator = (parser const& other) {
+			if(this != &other)
+				*this = parser{other};
+			return *this;
+		}
+		
+		
+		parser(parser&& other) noexcept
+		: parser{std::move(other), other.buffer_.data()} { }
+		
+		
+		// copies storage when resources differ
+		parser& operator = (parser&& other) {
+			auto const* const from = other.buffer_.data();
+			buffer_ = std::move(other.buffer_);
+			values_ = std::move(other.values_);
+			cursor_ = other.cursor_;
+			options_ = other.options_;
+			index_slots_ = std::move(other.index_slots_);
+			indexes_ = std::move(other.indexes_);
+			indexed_objects_ = other.indexed_objects_;
+			shapes_ = std::move(other.shapes_);
+			shapes_count_ = other.shapes_count_;
+			last_shape_ = other.last_shape_;
+			frames_ = std::move(other.frames_);
+			text_ = other.text_;
+			rebase(from);
+			return *this;
+		}
+		
+		
+		explicit parser(options const& opts) noexcept
+		: options_{opts} { }
+		
+		
+#if JESSY_PMR
+		// all storage of parser is allocated from resource
+		explicit parser(std::pmr::memory_resource* resource, options const& opts = options{})
+		: buffer_(resource),
+		  values_(resource),
+		  options_{opts},
+		  index_slots_(resource),
+		  indexes_(resource),
+		  shapes_(resource),
+		  frames_(resource) { }
+#endif
+		
+		
+		explicit parser(size_type reserve_tokens,
+		                size_type buffer_size,
+		                options const& opts = options{})
+		: options_{opts} {
+			values_.reserve(reserve_tokens);
 			buffer_.reserve(buffer_size);
 		}
 		
@@ -472,69 +3143,630 @@ namespace jessy {
 			buffer_.clear();
 			values_.clear();
 			cursor_ = nullptr;
+			clear_indexes();
+			clear_shapes();
 		}
 		
 		
 		result parse(std::string_view text) {
-			values_.clear();
-			buffer_ = text;
-			cursor_ = buffer_.data();
+			return parse_in_place(assign(text), text.size());
+		}
+		
+		
+		// parsed values are moved to out, parser takes previous storage of out
+		result parse(std::string_view text, document& out) {
+			auto const parsed = parse(text);
+			detach(out);
+			return parsed;
+		}
+		
+		
+		// values are written to out as compact nodes, text is copied to out
+		result parse(std::string_view text, compact_document& out) {
+			out.clear();
+			if(text.size() > compact_document::max_offset)
+				return result::capacity_exceeded;
+			out.buffer_.reserve(text.size() + padding);
+			out.buffer_.append(text);
+			out.buffer_.append(padding, '\0');
+			prepare(out.buffer_.data(), text.size());
+			return parse_nodes(out.nodes_);
+		}
+		
+		
+		// text parsed in place or into caller chars is copied to out
+		void detach(document& out) {
+			out.clear();
+			auto const* from = buffer_.data();
+			if(text_ != nullptr && text_ != buffer_.data()) {
+				from = text_;
+				out.buffer_.reserve(size_type(cursor_ - text_) + padding);
+				out.buffer_.assign(text_, size_type(cursor_ - text_));
+				out.buffer_.append(padding, '\0');
+			} else if(out.buffer_.get_allocator() == buffer_.get_allocator())
+				buffer_.swap(out.buffer_);
+			else {
+				out.buffer_ = buffer_;
+				buffer_.clear();
+			}
+			values_.move_to(out.values_);
+			value::rebase(out.values_.data(), out.values_.data() + out.values_.size(),
+			              from, out.buffer_.data(), out.buffer_.size());
+			cursor_ = nullptr;
+			text_ = nullptr;
+			clear_indexes();
+		}
+		
+		
+		// members out of wanted paths are validated but not emitted
+		result parse(std::string_view text, projection const& wanted) {
+			return parse_in_place(assign(text), text.size(), wanted);
+		}
+		
+		
+		// text is copied to chars and values are written to values, both outlive parsed values,
+		// capacity_exceeded is returned instead of allocating when text + padding or values do not fit,
+		// with cache_shapes only shape table grown by earlier parses is used and reset when full
+		result parse(std::string_view text,
+		             value* values, size_type max_values,
+		             char* chars, size_type max_chars) {
+			if(max_chars < padding || text.size() > max_chars - padding)
+				return result::capacity_exceeded;
+			std::memcpy(chars, text.data(), text.size());
+			std::memset(chars + text.size(), 0, padding);
+			projection_ = nullptr;
+			prepare(chars, text.size());
+			values_.use(values, max_values);
+			return parse_value();
+		}
+		
+		
+		// data should be writable for size + padding bytes and outlive parsed values
+		result parse_in_place(char* data, size_type size) {
+			projection_ = nullptr;
+			return start(data, size);
+		}
+		
+		
+		result parse_in_place(char* data, size_type size, projection const& wanted) {
+			projection_ = wanted.nodes_.front().whole ? nullptr : &wanted;
+			wanted_ = 0;
+			return start(data, size);
+		}
+		
+		
+		// data should be writable for size + padding bytes and outlive out
+		result parse_in_place(char* data, size_type size, compact_document& out) {
+			out.clear();
+			if(size > compact_document::max_offset)
+				return result::capacity_exceeded;
+			out.borrowed_ = data;
+			prepare(data, size);
+			return parse_nodes(out.nodes_);
+		}
+		
+		
+		// checks text like parse with default options but emits no values
+		result validate(std::string_view text) {
+			return validate_in_place(assign(text), text.size());
+		}
+		
+		
+		// data should be readable for size + padding bytes, only data[size] is written
+		result validate_in_place(char* data, size_type size) {
+			prepare(data, size);
+			return skip_value();
+		}
+		
+		
+		// fills bound struct straight from text without value nodes, see jessy::binding
+		template<typename T>
+		result parse_into(std::string_view text, T& out) {
+			prepare(assign(text), text.size());
+			return read_value(out);
+		}
+		
+		
+		value const* root() const noexcept {
+			if(values_.empty())
+				return &value::null;
+			return &values_.front();
+		}
+		
+		
+		// object should belong to this parser, index of large object is built on first lookup
+		value::object::const_iterator find(value::object const& object, std::string_view name) {
+			if(object.size() < index_threshold)
+				return object.find(object.begin(), name);
+			auto const& index = index_of(object);
+			auto const hash = detail::key_hash(name);
+			auto const payload = value_tag::payload(name.size(), hash);
+			auto slot = hash & index.mask;
+			for(;;) {
+				auto const offset = index_slots_[index.first + slot];
+				if(offset == 0)
+					return object.end();
+				auto const* key = object.begin_ + offset - 1;
+				if(key->is_key(payload, name))
+					return value::object::const_iterator{key};
+				slot = (slot + 1) & index.mask;
+			}
+		}
+		
+#if JESSY_PMR
+		std::pmr::memory_resource* resource() const noexcept {
+			return values_.resource();
+		}
+#endif
+		
+	private:
+	
+		parser(parser&& other, char const* from) noexcept
+		: buffer_(std::move(other.buffer_)),
+		  values_(std::move(other.values_)),
+		  cursor_{other.cursor_},
+		  options_{other.options_},
+		  index_slots_(std::move(other.index_slots_)),
+		  indexes_(std::move(other.indexes_)),
+		  indexed_objects_{other.indexed_objects_},
+		  shapes_(std::move(other.shapes_)),
+		  shapes_count_{other.shapes_count_},
+		  last_shape_{other.last_shape_},
+		  frames_(std::move(other.frames_)),
+		  text_{other.text_} {
+			rebase(from);
+		}
+		
+		
+		// text parsed in place stays where it is
+		void rebase(char const* from) noexcept {
+			auto* const to = buffer_.data();
+			if(from == to)
+				return;
+			value::rebase(values_.data(), values_.data() + values_.size(), from, to, buffer_.size());
+			auto const first = std::uintptr_t(from);
+			auto const last = first + buffer_.size();
+			auto const moved = [&](char const* p) noexcept {
+				return std::uintptr_t(p) >= first && std::uintptr_t(p) <= last;
+			};
+			if(moved(cursor_))
+				cursor_ = to + (std::uintptr_t(cursor_) - first);
+			if(moved(text_))
+				text_ = to + (std::uintptr_t(text_) - first);
+		}
+		
+		
+		result start(char* data, size_type size) {
+			prepare(data, size);
 			return parse_value();
 		}
 		
 		
-		value const* root() const noexcept {
-			if(values_.empty())
-				return &value::null;
-			return &values_.front();
-		}
-		
-	private:
-	
-	
-		static bool is_digit(char c) noexcept {
-			constexpr auto t = true;
-			constexpr auto f = false;
-			static constexpr bool map[] = {
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,t,t,t,t,t,t,t,t,t,t,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
-				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f
-			};
-			static_assert(sizeof(map) == 256, "Invalid digits map");
-			return map[unsigned(c)];
-		}
-	
-	
-		result parse_value() {
+		void prepare(char* data, size_type size) {
+			if(frames_.size() != options_.max_depth)
+				frames_.resize(options_.max_depth);
+			values_.use_own();
+			values_.clear();
+			clear_indexes();
+			data[size] = '\0';
+			cursor_ = data;
+			text_ = data;
+		}
+		
+		
+		char* assign(std::string_view text) {
+			buffer_.clear();
+			buffer_.reserve(text.size() + padding);
+			buffer_.append(text);
+			buffer_.append(padding, '\0');
+			return buffer_.data();
+		}
+		
+		
+		void clear_indexes() noexcept {
+			if(indexed_objects_ == 0)
+				return;
+			index_slots_.clear();
+			for(auto& index: indexes_)
+				index.object = 0;
+			indexed_objects_ = 0;
+		}
+		
+		
+		object_index const& index_of(value::object const& object) {
+			auto const position = std::uint32_t(object.begin_ - values_.data());
+			if(!indexes_.empty()) {
+				auto const mask = indexes_.size() - 1;
+				for(auto i = (position * 0x9E3779B9u) & mask;; i = (i + 1) & mask) {
+					if(indexes_[i].object == position)
+						return indexes_[i];
+					if(indexes_[i].object == 0)
+						break;
+				}
+			}
+			if((indexed_objects_ + 1) * 2 > indexes_.size())
+				grow_indexes();
+			auto const mask = indexes_.size() - 1;
+			auto i = (position * 0x9E3779B9u) & mask;
+			while(indexes_[i].object != 0)
+				i = (i + 1) & mask;
+			auto& index = indexes_[i];
+			index = build_index(object, position);
+			++indexed_objects_;
+			return index;
+		}
+		
+		
+		void grow_indexes() {
+			auto indexes = detail::vector<object_index>(indexes_.empty() ? 16 : indexes_.size() * 2,
+			                                              object_index{0, 0, 0},
+			                                              indexes_.get_allocator());
+			auto const mask = indexes.size() - 1;
+			for(auto const& index: indexes_) {
+				if(index.object == 0)
+					continue;
+				auto i = (index.object * 0x9E3779B9u) & mask;
+				while(indexes[i].object != 0)
+					i = (i + 1) & mask;
+				indexes[i] = index;
+			}
+			indexes_.swap(indexes);
+		}
+		
+		
+		// table is emptied when options::max_shapes are known, ids go on and are not reused soon
+		size_type shape_of(std::uint64_t fingerprint) {
+			if(max_shape_id == 0 || options_.max_shapes == 0)
+				return 0;
+			if(!shapes_.empty()) {
+				auto const mask = shapes_.size() - 1;
+				for(auto i = size_type(fingerprint) & mask; shapes_[i].fingerprint != 0; i = (i + 1) & mask)
+					if(shapes_[i].fingerprint == fingerprint)
+						return shapes_[i].id;
+			}
+			if(shapes_count_ >= options_.max_shapes)
+				clear_shapes();
+			if((shapes_count_ + 1) * 2 > shapes_.size()) {
+				// parse into caller spans never allocates, its shapes go to table grown before
+				if(values_.fixed()) {
+					if(shapes_.empty())
+						return 0;
+					clear_shapes();
+				} else
+					grow_shapes();
+			}
+			auto const mask = shapes_.size() - 1;
+			auto i = size_type(fingerprint) & mask;
+			while(shapes_[i].fingerprint != 0)
+				i = (i + 1) & mask;
+			last_shape_ = last_shape_ == max_shape_id ? 1 : last_shape_ + 1;
+			shapes_[i] = object_shape{fingerprint, last_shape_};
+			++shapes_count_;
+			return last_shape_;
+		}
+		
+		
+		void clear_shapes() noexcept {
+			if(shapes_count_ == 0)
+				return;
+			for(auto& shape: shapes_)
+				shape = object_shape{0, 0};
+			shapes_count_ = 0;
+		}
+		
+		
+		void grow_shapes() {
+			auto shapes = detail::vector<object_shape>(shapes_.empty() ? 64 : shapes_.size() * 2,
+			                                             object_shape{0, 0},
+			                                             shapes_.get_allocator());
+			auto const mask = shapes.size() - 1;
+			for(auto const& shape: shapes_) {
+				if(shape.fingerprint == 0)
+					continue;
+				auto i = size_type(shape.fingerprint) & mask;
+				while(shapes[i].fingerprint != 0)
+					i = (i + 1) & mask;
+				shapes[i] = shape;
+			}
+			shapes_.swap(shapes);
+		}
+		
+		
+		object_index build_index(value::object const& object, std::uint32_t position) {
+			auto size = size_type(16);
+			while(size < object.size() * 2)
+				size *= 2;
+			auto const first = index_slots_.size();
+			index_slots_.resize(first + size, 0);
+			auto const mask = std::uint32_t(size - 1);
+			for(auto const* key = object.begin_; key != object.end_; key = value::next_of(key + 1)) {
+				auto const name = std::string_view{key->data_.text, key->tag_.length()};
+				auto slot = detail::key_hash(name) & mask;
+				while(index_slots_[first + slot] != 0)
+					slot = (slot + 1) & mask;
+				index_slots_[first + slot] = std::uint32_t(key - object.begin_ + 1);
+			}
+			return object_index{position, mask, first};
+		}
+	
+	
+		static bool is_digit(char c) noexcept {
+			constexpr auto t = true;
+			constexpr auto f = false;
+			static constexpr bool map[] = {
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,t,t,t,t,t,t,t,t,t,t,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,
+				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f
+			};
+			static_assert(sizeof(map) == 256, "Invalid digits map");
+			return map[std::uint8_t(c)];
+		}
+	
+	
+		// containers are tracked in frames_, so nesting costs no call frames
+		result parse_value() {
+			auto depth = size_type(0);
+			auto e = result::ok;
+		value:
+			switch(skip()) {
+				case '{':
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++] = {values_.size(), 0, 0xCBF29CE484222325, projection_, wanted_, true};
+					if(values_.push(value_type::object) == nullptr)
+						return result::capacity_exceeded;
+					++cursor_;
+					if(skip() == '}')
+						goto close;
+					goto member;
+				case '[':
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++] = {values_.size(), 0, 0, projection_, wanted_, false};
+					if(values_.push(value_type::array) == nullptr)
+						return result::capacity_exceeded;
+					++cursor_;
+					if(skip() == ']')
+						goto close;
+					goto value;
+				case '"':
+					e = parse_string();
+					break;
+				case 'n':
+					e = parse_null();
+					break;
+				case 't':
+					e = parse_true();
+					break;
+				case 'f':
+					e = parse_false();
+					break;
+				case '-':
+					if(!is_digit(cursor_[1]))
+						return result::illformed_json;
+					e = parse_number();
+					break;
+				case '0': case '1': case '2': case '3': case '4':
+				case '5': case '6': case '7': case '8': case '9':
+					e = parse_number();
+					break;
+				case '\0':
+					return result::incomplete_json;
+				default:
+					return result::illformed_json;
+			}
+			if(e != result::ok)
+				return e;
+		next:
+			if(depth == 0)
+				return result::ok;
+			{
+				auto& top = frames_[depth - 1];
+				projection_ = top.selected;
+				wanted_ = top.wanted;
+				auto const delim = skip();
+				if(top.object) {
+					if(delim == ',') {
+						++cursor_;
+						skip();
+						goto member;
+					}
+					if(delim != '}')
+						return result::illformed_json;
+				} else {
+					++top.length;
+					if(delim == ',') {
+						++cursor_;
+						goto value;
+					}
+					if(delim != ']')
+						return result::illformed_json;
+				}
+			}
+		close:
+			{
+				auto const& top = frames_[--depth];
+				if(top.length > value_tag::max_length)
+					return result::length_exceeded;
+				++cursor_;
+				auto& container = values_[top.index];
+				container.members_info(top.length, values_.size() - top.index - 1);
+				if(top.object && options_.cache_shapes && top.length != 0)
+					container.tag_.aux(shape_of(top.fingerprint | 1));
+			}
+			goto next;
+		member:
+			{
+				auto& top = frames_[depth - 1];
+				if(*cursor_ != '\"')
+					return result::illformed_json;
+				auto const* text = cursor_;
+				auto size = size_type(0);
+				e = scan_string(text, size);
+				if(e != result::ok)
+					return e;
+				if(size > value_tag::max_length)
+					return result::length_exceeded;
+				if(skip() != ':')
+					return result::illformed_json;
+				++cursor_;
+				auto const hash = detail::key_hash({text, size});
+				auto const wanted = projection_ == nullptr ? wanted_
+					: projection_->find(wanted_, value_tag::payload(size, hash), {text, size});
+				if(wanted == projection::none) {
+					e = skip_value(depth);
+					if(e != result::ok)
+						return e;
+					goto next;
+				}
+				auto* const name = values_.push(value_type::string, text, size);
+				if(name == nullptr)
+					return result::capacity_exceeded;
+				name->tag_.aux(hash);
+				top.fingerprint = (top.fingerprint ^ name->tag_.payload()) * 0x100000001B3;
+				++top.length;
+				if(projection_ != nullptr) {
+					if(projection_->nodes_[wanted].whole)
+						projection_ = nullptr;
+					wanted_ = wanted;
+				}
+			}
+			goto value;
+		}
+		
+		
+		// grammar of parse_value, values are compact nodes with text offsets from text_
+		result parse_nodes(detail::vector<compact_node>& nodes) {
+			auto depth = size_type(0);
+			auto e = result::ok;
+		value:
 			switch(skip()) {
 				case '{':
-					return parse_object();
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++] = {nodes.size(), 0, 0, nullptr, 0, true};
+					nodes.push_back(compact_node::make(value_type::object));
+					++cursor_;
+					if(skip() == '}')
+						goto close;
+					goto member;
 				case '[':
-					return parse_array();
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++] = {nodes.size(), 0, 0, nullptr, 0, false};
+					nodes.push_back(compact_node::make(value_type::array));
+					++cursor_;
+					if(skip() == ']')
+						goto close;
+					goto value;
 				case '"':
-					return parse_string();
+					e = push_string(nodes);
+					break;
 				case 'n':
-					return parse_null();
+					e = scan_null();
+					nodes.push_back(compact_node::make(value_type::null));
+					break;
 				case 't':
-					return parse_true();
+					e = scan_true();
+					nodes.push_back(compact_node::make(value_type::boolean, 1));
+					break;
 				case 'f':
-					return parse_false();
+					e = scan_false();
+					nodes.push_back(compact_node::make(value_type::boolean, 0));
+					break;
 				case '-':
 					if(!is_digit(cursor_[1]))
 						return result::illformed_json;
-					return parse_number();
+					e = push_number(nodes);
+					break;
 				case '0': case '1': case '2': case '3': case '4':
 				case '5': case '6': case '7': case '8': case '9':
-					return parse_number();
+					e = push_number(nodes);
+					break;
 				case '\0':
 					return result::incomplete_json;
 				default:
 					return result::illformed_json;
 			}
+			if(e != result::ok)
+				return e;
+		next:
+			if(depth == 0)
+				return result::ok;
+			{
+				auto& top = frames_[depth - 1];
+				auto const delim = skip();
+				if(top.object) {
+					if(delim == ',') {
+						++cursor_;
+						skip();
+						goto member;
+					}
+					if(delim != '}')
+						return result::illformed_json;
+				} else {
+					++top.length;
+					if(delim == ',') {
+						++cursor_;
+						goto value;
+					}
+					if(delim != ']')
+						return result::illformed_json;
+				}
+			}
+		close:
+			{
+				auto const& top = frames_[--depth];
+				if(top.length > compact_document::max_length)
+					return result::length_exceeded;
+				++cursor_;
+				auto& container = nodes[top.index];
+				container.head |= std::uint32_t(top.length);
+				container.offset = std::uint32_t(nodes.size() - top.index - 1);
+			}
+			goto next;
+		member:
+			if(*cursor_ != '\"')
+				return result::illformed_json;
+			e = push_string(nodes);
+			if(e != result::ok)
+				return e;
+			if(skip() != ':')
+				return result::illformed_json;
+			++cursor_;
+			++frames_[depth - 1].length;
+			goto value;
+		}
+		
+		
+		result push_string(detail::vector<compact_node>& nodes) {
+			auto const* text = cursor_;
+			auto length = size_type(0);
+			auto const e = scan_string(text, length);
+			if(e != result::ok)
+				return e;
+			if(length > compact_document::max_length)
+				return result::length_exceeded;
+			nodes.push_back(compact_node::make(value_type::string, length, size_type(text - text_)));
+			return result::ok;
+		}
+		
+		
+		result push_number(detail::vector<compact_node>& nodes) {
+			auto const* mark = cursor_;
+			auto kind = value_tag::size_type(0);
+			auto const e = scan_number(kind);
+			if(e != result::ok)
+				return e;
+			auto const length = size_type(cursor_ - mark);
+			if(length > compact_document::max_length)
+				return result::length_exceeded;
+			nodes.push_back(compact_node::make(value_type::number, length, size_type(mark - text_), kind));
+			return result::ok;
 		}
 		
 		
@@ -551,101 +3783,62 @@ namespace jessy {
 				 f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f,f
 			};
 			static_assert(sizeof(map) == 256, "Invalid whitespace map");
-			while(map[unsigned(*cursor_)])
-				++cursor_;
-			return *cursor_;
-		}
-		
-		
-		result parse_object() {
-			values_.emplace_back(value_type::object);
-			auto const original_size = values_.size();
-			++cursor_;
-			auto length = size_type(0);
-			if(skip() != '}')
-				for(;;) {
-					if(*cursor_ != '\"')
-						return result::illformed_json;
-					parse_string();
-					if(skip() != ':')
-						return result::illformed_json;
-					++cursor_;
-					auto const e = parse_value();
-					if(e != result::ok)
-						return e;
-					++length;
-					auto const delim = skip();
-					if(delim == ',') {
-						++cursor_;
-						skip();
-						continue;
-					}
-					if(delim != '}')
-						return result::illformed_json;
-					break;
-				}
+			if(!map[std::uint8_t(*cursor_)])
+				return *cursor_;
 			++cursor_;
-			values_[original_size - 1].members_info(length,
-			                                        values_.size() - original_size);
-			return result::ok;
+			if(!map[std::uint8_t(*cursor_)])
+				return *cursor_;
+			cursor_ += detail::count_whitespace(cursor_);
+			return *cursor_;
 		}
 		
 		
-		result parse_array() {
-			values_.emplace_back(value_type::array);
-			auto const original_size = values_.size();
-			++cursor_;
+		result parse_string() {
+			auto const* text = cursor_;
 			auto length = size_type(0);
-			if(skip() != ']')				
-				for(;;) {
-					auto const e = parse_value();
-					if(e != result::ok)
-						return e;
-					++length;
-					auto const delim = skip();
-					if(delim == ',') {
-						++cursor_;
-						continue;
-					}
-					if(delim != ']')
-						return result::illformed_json;
-					break;
-				}
-			++cursor_;
-			values_[original_size - 1].members_info(length,
-			                                        values_.size() - original_size);
+			auto const e = scan_string(text, length);
+			if(e != result::ok)
+				return e;
+			if(length > value_tag::max_length)
+				return result::length_exceeded;
+			if(values_.push(value_type::string, text, length) == nullptr)
+				return result::capacity_exceeded;
 			return result::ok;
 		}
 		
 		
-		result parse_string() {
+		result scan_string(char const*& text, size_type& length) {
 			auto const* mark = ++cursor_;
-			for(;;)
+			for(;;) {
+				cursor_ += detail::count_plain(cursor_);
 				switch(*cursor_) {
 					case '\n':
 					case '\0':
 						return result::unclosed_string;
 					case '\\':
-						return parse_escaped_string(mark);
+						return scan_escaped_string(mark, text, length);
 					case '"':
-						values_.emplace_back(value_type::string,
-						                     mark,
-											 size_type(cursor_ - mark));
+						text = mark;
+						length = size_type(cursor_ - mark);
 						++cursor_;
 						return result::ok;
 					default:
 						++cursor_;
 						continue;
 				}
+			}
 		}
 		
 		
-		result parse_escaped_string(char const* mark) {
+		result scan_escaped_string(char const* mark, char const*& text, size_type& length) {
 			auto* p = cursor_;
 			auto escape = parse_escaped_character(p);
 			if(escape != result::ok)
 				return escape;
-			for(;;)
+			for(;;) {
+				auto const n = detail::copy_plain(p, cursor_);
+				p += n;
+				cursor_ += n;
 				switch(*cursor_) {
 					case '\n':
 					case '\0':
@@ -656,15 +3849,15 @@ namespace jessy {
 							return escape;
 						continue;
 					case '"':
-						values_.emplace_back(value_type::string,
-						                     mark,
-											 size_type(p - mark));
+						text = mark;
+						length = size_type(p - mark);
 						++cursor_;
 						return result::ok;
 					default:
 						*p++ = *cursor_++;
 						continue;
 				}
+			}
 		}
 		
 		
@@ -768,30 +3961,58 @@ namespace jessy {
 		
 		
 		result parse_null() {
+			auto const e = scan_null();
+			if(e != result::ok)
+				return e;
+			if(values_.push(value::null) == nullptr)
+				return result::capacity_exceeded;
+			return result::ok;
+		}
+		
+		
+		result parse_true() {
+			auto const e = scan_true();
+			if(e != result::ok)
+				return e;
+			if(values_.push(true) == nullptr)
+				return result::capacity_exceeded;
+			return result::ok;
+		}
+		
+		
+		result parse_false() {
+			auto const e = scan_false();
+			if(e != result::ok)
+				return e;
+			if(values_.push(false) == nullptr)
+				return result::capacity_exceeded;
+			return result::ok;
+		}
+		
+		
+		result scan_null() noexcept {
 			auto const is_null = cursor_[1] == 'u'
 				&& cursor_[2] == 'l'
 				&& cursor_[3] == 'l';
 			if(!is_null)
 				return result::illformed_json;
 			cursor_ += 4;
-			values_.push_back(value::null);
 			return result::ok;
 		}
 		
 		
-		result parse_true() {
+		result scan_true() noexcept {
 			auto const is_true = cursor_[1] == 'r'
 				&& cursor_[2] == 'u'
 				&& cursor_[3] == 'e';
 			if(!is_true)
 				return result::illformed_json;
 			cursor_ += 4;
-			values_.emplace_back(true);
 			return result::ok;
 		}
 		
 		
-		result parse_false() {
+		result scan_false() noexcept {
 			auto const is_false = cursor_[1] == 'a'
 				&& cursor_[2] == 'l'
 				&& cursor_[3] == 's'
@@ -799,42 +4020,376 @@ namespace jessy {
 			if(!is_false)
 				return result::illformed_json;
 			cursor_ += 5;
-			values_.emplace_back(false);
 			return result::ok;
 		}
 		
 		
 		result parse_number() {
-			auto const* mark = cursor_++;
+			auto const* mark = cursor_;
+			auto kind = value_tag::size_type(0);
+			auto const e = scan_number(kind);
+			if(e != result::ok)
+				return e;
+			auto const length = size_type(cursor_ - mark);
+			if(length > value_tag::max_length)
+				return result::length_exceeded;
+			auto* const number = values_.push(value_type::number, mark, length);
+			if(number == nullptr)
+				return result::capacity_exceeded;
+			number->tag_.flags(kind);
+			if(!options_.decode_numbers)
+				return result::ok;
+			if(!number->decode_number())
+				return result::number_is_out_of_range;
+			return result::ok;
+		}
+		
+		
+		result scan_number(value_tag::size_type& kind) noexcept {
+			++cursor_;
 			while(is_digit(*cursor_))
 				++cursor_;
 			if(*cursor_ == '.') {
+				kind |= value::number_fraction;
 				++cursor_;
-				if(!is_digit(*cursor_)) {
-					std::printf("No digit after point: %c\n", *cursor_);
+				if(!is_digit(*cursor_))
 					return result::invalid_number;
-				}
 				++cursor_;
 				while(is_digit(*cursor_))
 					++cursor_;
 			}
 			if(*cursor_ == 'e' || *cursor_ == 'E') {
+				kind |= value::number_exponent;
 				++cursor_;
 				if(*cursor_ == '+' || *cursor_ == '-') {
 					++cursor_;
 				}
-				if(!is_digit(*cursor_)) {
-					std::printf("No digit after exponent\n");
+				if(!is_digit(*cursor_))
 					return result::invalid_number;
-				}
 				while(is_digit(*cursor_))
 					++cursor_;
 			}
-			auto const length = size_type(cursor_ - mark);
-			values_.emplace_back(value_type::number, mark, length);
 			return result::ok;
 		}
 		
+		
+		bool at_number() const noexcept {
+			if(*cursor_ == '-')
+				return is_digit(cursor_[1]);
+			return is_digit(*cursor_);
+		}
+		
+		
+		result unexpected(char c) const noexcept {
+			switch(c) {
+				case '\0':
+					return result::incomplete_json;
+				case '{': case '[': case '"': case 'n': case 't': case 'f':
+					return result::type_mismatch;
+				default:
+					return at_number() ? result::type_mismatch : result::illformed_json;
+			}
+		}
+		
+		
+		// validates value without emitting, depth is number of enclosing containers
+		result skip_value(size_type depth = 0) {
+			auto const outer = depth;
+			auto e = result::ok;
+		value:
+			switch(skip()) {
+				case '{':
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++].object = true;
+					++cursor_;
+					if(skip() == '}')
+						goto close;
+					goto member;
+				case '[':
+					if(depth == frames_.size())
+						return result::depth_exceeded;
+					frames_[depth++].object = false;
+					++cursor_;
+					if(skip() == ']')
+						goto close;
+					goto value;
+				case '"':
+					e = skip_string();
+					break;
+				case 'n':
+					e = scan_null();
+					break;
+				case 't':
+					e = scan_true();
+					break;
+				case 'f':
+					e = scan_false();
+					break;
+				case '\0':
+					return result::incomplete_json;
+				default: {
+					if(!at_number())
+						return result::illformed_json;
+					auto kind = value_tag::size_type(0);
+					e = scan_number(kind);
+					break;
+				}
+			}
+			if(e != result::ok)
+				return e;
+		next:
+			if(depth == outer)
+				return result::ok;
+			{
+				auto const delim = skip();
+				if(frames_[depth - 1].object) {
+					if(delim == ',') {
+						++cursor_;
+						skip();
+						goto member;
+					}
+					if(delim != '}')
+						return result::illformed_json;
+				} else {
+					if(delim == ',') {
+						++cursor_;
+						goto value;
+					}
+					if(delim != ']')
+						return result::illformed_json;
+				}
+			}
+		close:
+			--depth;
+			++cursor_;
+			goto next;
+		member:
+			if(*cursor_ != '\"')
+				return result::illformed_json;
+			e = skip_string();
+			if(e != result::ok)
+				return e;
+			if(skip() != ':')
+				return result::illformed_json;
+			++cursor_;
+			goto value;
+		}
+		
+		
+		result skip_string() noexcept {
+			++cursor_;
+			for(;;) {
+				cursor_ += detail::count_plain(cursor_);
+				switch(*cursor_) {
+					case '\n':
+					case '\0':
+						return result::unclosed_string;
+					case '\\': {
+						auto const e = skip_escaped_character();
+						if(e != result::ok)
+							return e;
+						continue;
+					}
+					case '"':
+						++cursor_;
+						return result::ok;
+					default:
+						++cursor_;
+						continue;
+				}
+			}
+		}
+		
+		
+		result skip_escaped_character() noexcept {
+			++cursor_;
+			switch(*cursor_) {
+				case '"': case '\\': case '/': case 'b':
+				case 'f': case 'n': case 'r': case 't':
+					++cursor_;
+					return result::ok;
+				case 'u':
+					for(auto i = 1; i <= 4; ++i)
+						if(hex_digit(cursor_[i]) == 16)
+							return result::invalid_escape_sequence;
+					cursor_ += 5;
+					return result::ok;
+				default:
+					return result::invalid_escape_sequence;
+			}
+		}
+		
+		
+		template<typename T>
+		result read_value(T& out) {
+			auto const c = skip();
+			if constexpr(std::is_same_v<T, bool>) {
+				if(c == 't') {
+					out = true;
+					return scan_true();
+				}
+				if(c == 'f') {
+					out = false;
+					return scan_false();
+				}
+				return unexpected(c);
+			} else if constexpr(std::is_enum_v<T> && detail::has_names<T>::value) {
+				if(c != '"')
+					return unexpected(c);
+				auto const* text = cursor_;
+				auto length = size_type(0);
+				auto const e = scan_string(text, length);
+				if(e != result::ok)
+					return e;
+				for(auto const& [name, each]: binding<T>::names)
+					if(name == std::string_view{text, length}) {
+						out = each;
+						return result::ok;
+					}
+				return result::type_mismatch;
+			} else if constexpr(std::is_enum_v<T>) {
+				auto underlying = std::underlying_type_t<T>{};
+				auto const e = read_value(underlying);
+				if(e == result::ok)
+					out = T(underlying);
+				return e;
+			} else if constexpr(std::is_integral_v<T>) {
+				if(!at_number())
+					return unexpected(c);
+				auto const* mark = cursor_;
+				auto kind = value_tag::size_type(0);
+				auto const e = scan_number(kind);
+				if(e != result::ok)
+					return e;
+				if(kind != 0)
+					return result::type_mismatch;
+				if constexpr(std::is_signed_v<T>) {
+					auto integer = std::int64_t(0);
+					if(!detail::parse_int(mark, cursor_, integer)
+					   || integer < std::int64_t(std::numeric_limits<T>::min())
+					   || integer > std::int64_t(std::numeric_limits<T>::max()))
+						return result::number_is_out_of_range;
+					out = T(integer);
+				} else {
+					auto integer = std::uint64_t(0);
+					if(!detail::parse_uint(mark, cursor_, integer)
+					   || integer > std::uint64_t(std::numeric_limits<T>::max()))
+						return result::number_is_out_of_range;
+					out = T(integer);
+				}
+				return result::ok;
+			} else if constexpr(std::is_floating_point_v<T>) {
+				if(!at_number())
+					return unexpected(c);
+				auto const* mark = cursor_;
+				auto kind = value_tag::size_type(0);
+				auto const e = scan_number(kind);
+				if(e != result::ok)
+					return e;
+				auto real = 0.0;
+				if(!detail::parse_double(mark, cursor_, real))
+					return result::number_is_out_of_range;
+				out = T(real);
+				return result::ok;
+			} else if constexpr(std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>) {
+				if(c != '"')
+					return unexpected(c);
+				auto const* text = cursor_;
+				auto length = size_type(0);
+				auto const e = scan_string(text, length);
+				if(e != result::ok)
+					return e;
+				out = T{text, length};
+				return result::ok;
+			} else if constexpr(detail::is_optional<T>::value) {
+				if(c != 'n')
+					return read_value(out.emplace());
+				out.reset();
+				return scan_null();
+			} else if constexpr(detail::is_vector<T>::value) {
+				if(c != '[')
+					return unexpected(c);
+				out.clear();
+				++cursor_;
+				if(skip() != ']')
+					for(;;) {
+						auto const e = read_value(out.emplace_back());
+						if(e != result::ok)
+							return e;
+						auto const delim = skip();
+						if(delim == ',') {
+							++cursor_;
+							continue;
+						}
+						if(delim != ']')
+							return result::illformed_json;
+						break;
+					}
+				++cursor_;
+				return result::ok;
+			} else {
+				static_assert(detail::has_fields<T>::value, "jessy::binding<T>::fields is not specialized");
+				if(c != '{')
+					return unexpected(c);
+				return read_object(out);
+			}
+		}
+		
+		
+		template<typename T>
+		result read_object(T& out) {
+			constexpr auto size = std::tuple_size_v<detail::fields_of<T>>;
+			using members = std::make_index_sequence<size>;
+			bool seen[size]{};
+			++cursor_;
+			if(skip() != '}')
+				for(;;) {
+					if(*cursor_ != '\"')
+						return result::illformed_json;
+					auto const* text = cursor_;
+					auto length = size_type(0);
+					auto const key = scan_string(text, length);
+					if(key != result::ok)
+						return key;
+					if(skip() != ':')
+						return result::illformed_json;
+					++cursor_;
+					auto const n = dispatcher<detail::field_names<T>::value>::index_of({text, length});
+					auto e = result::ok;
+					if(n == size) {
+						e = skip_value();
+					} else {
+						seen[n] = true;
+						e = read_member(n, out, members{});
+					}
+					if(e != result::ok)
+						return e;
+					auto const delim = skip();
+					if(delim == ',') {
+						++cursor_;
+						skip();
+						continue;
+					}
+					if(delim != '}')
+						return result::illformed_json;
+					break;
+				}
+			++cursor_;
+			detail::reset_absent_fields(seen, out, members{});
+			if(!detail::has_required_fields<T>(seen, members{}))
+				return result::missing_field;
+			return result::ok;
+		}
+		
+		
+		template<typename T, std::size_t... I>
+		result read_member(std::size_t n, T& out, std::index_sequence<I...>) {
+			auto e = result::ok;
+			((n == I ? (void)(e = read_value(out.*std::get<I>(binding<T>::fields).member)) : (void)0), ...);
+			return e;
+		}
+		
 	}; // parser
 	
 	
@@ -4,6 +4,66 @@
 
 #include <jessy/jessy.hpp>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+	enum class side { buy, sell };
+	enum class venue: std::uint8_t { lmax = 1, cme = 2 };
+	
+	struct leg {
+		std::string symbol;
+		double ratio;
+	};
+	
+	struct order {
+		std::uint64_t id;
+		std::string_view symbol;
+		double price;
+		std::int32_t qty;
+		side direction;
+		venue where;
+		bool active;
+		std::optional<std::string> comment;
+		std::vector<leg> legs;
+	};
+
+}
+
+
+template<>
+struct jessy::binding<side> {
+	static constexpr std::pair<std::string_view, side> names[] = {
+		{"buy", side::buy}, {"sell", side::sell}
+	};
+};
+
+
+template<>
+struct jessy::binding<leg> {
+	static constexpr auto fields = std::make_tuple(
+		jessy::field("symbol", &leg::symbol),
+		jessy::field("ratio", &leg::ratio));
+};
+
+
+template<>
+struct jessy::binding<order> {
+	static constexpr auto fields = std::make_tuple(
+		jessy::field("id", &order::id),
+		jessy::field("symbol", &order::symbol),
+		jessy::field("price", &order::price),
+		jessy::field("qty", &order::qty),
+		jessy::field("side", &order::direction),
+		jessy::field("venue", &order::where),
+		jessy::field("active", &order::active),
+		jessy::field("comment", &order::comment),
+		jessy::field("legs", &order::legs));
+};
+
 
 TEST_SUITE("jessy") {
     
@@ -63,6 +123,143 @@ TEST_SUITE("jessy") {
     }
 	
 	
+	SCENARIO("integer limits") {
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse("1700000000123"), jessy::result::ok);
+		REQUIRE_EQ(*parser.root()->as_int(), 1700000000123ll);
+		REQUIRE_EQ(parser.parse("9223372036854775807"), jessy::result::ok);
+		REQUIRE_EQ(*parser.root()->as_int(), INT64_MAX);
+		REQUIRE_EQ(parser.parse("9223372036854775808"), jessy::result::ok);
+		REQUIRE_FALSE(parser.root()->as_int());
+		REQUIRE_EQ(*parser.root()->as_uint(), 9223372036854775808ull);
+		REQUIRE_EQ(parser.parse("-9223372036854775808"), jessy::result::ok);
+		REQUIRE_EQ(*parser.root()->as_int(), INT64_MIN);
+		REQUIRE_FALSE(parser.root()->as_uint());
+		REQUIRE_EQ(parser.parse("-9223372036854775809"), jessy::result::ok);
+		REQUIRE_FALSE(parser.root()->as_int());
+		REQUIRE_EQ(parser.parse("18446744073709551615"), jessy::result::ok);
+		REQUIRE_EQ(*parser.root()->as_uint(), UINT64_MAX);
+		REQUIRE_EQ(parser.parse("18446744073709551616"), jessy::result::ok);
+		REQUIRE_FALSE(parser.root()->as_uint());
+		REQUIRE_EQ(parser.parse("123456789012345678901"), jessy::result::ok);
+		REQUIRE_FALSE(parser.root()->as_uint());
+		REQUIRE_EQ(parser.parse("0"), jessy::result::ok);
+		REQUIRE_EQ(*parser.root()->as_uint(), 0u);
+	}
+	
+	
+	SCENARIO("number classification") {
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse("[42, -4.2, 4e2, \"42\"]");
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const array = *parser.root()->as_array();
+		auto it = array.begin();
+		REQUIRE(it->is_integer());
+		REQUIRE_FALSE(it->is_float());
+		++it;
+		REQUIRE(it->is_float());
+		REQUIRE_FALSE(it->as_int());
+		REQUIRE_EQ(*it->as_double(), -4.2);
+		++it;
+		REQUIRE(it->is_float());
+		REQUIRE_FALSE(it->as_uint());
+		REQUIRE_EQ(*it->as_double(), 400.0);
+		++it;
+		REQUIRE_FALSE(it->is_integer());
+		REQUIRE_FALSE(it->is_float());
+	}
+	
+	
+	SCENARIO("decoded numbers") {
+		auto opts = jessy::options{};
+		opts.decode_numbers = true;
+		auto parser = jessy::parser{opts};
+		auto const parsed = parser.parse("[-42, 18446744073709551615, 9.9, 1e3, 36893488147419103232]");
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const array = *parser.root()->as_array();
+		auto it = array.begin();
+		REQUIRE_EQ(*it->as_int(), -42);
+		REQUIRE_FALSE(it->as_uint());
+		REQUIRE_EQ(*it->as_double(), -42.0);
+		++it;
+		REQUIRE_FALSE(it->as_int());
+		REQUIRE_EQ(*it->as_uint(), 18446744073709551615ull);
+		++it;
+		REQUIRE_FALSE(it->as_int());
+		REQUIRE_EQ(*it->as_double(), 9.9);
+		REQUIRE_EQ(*it->as_decimal(2), 990);
+		++it;
+		REQUIRE_EQ(*it->as_double(), 1000.0);
+		REQUIRE_EQ(*it->as_decimal(2, jessy::rounding::exact), 100000);
+		++it;
+		REQUIRE_EQ(*it->as_double(), 36893488147419103232.0);
+		REQUIRE(it->is_integer());
+		REQUIRE_FALSE(it->as_int());
+		REQUIRE_FALSE(it->as_uint());
+		REQUIRE_EQ(parser.parse("1e400"), jessy::result::number_is_out_of_range);
+	}
+	
+	
+	SCENARIO("double rounding") {
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse("[9.9, 0.1, 2.2250738585072011e-308, 4e-324, 1.7976931348623157e308, 9007199254740993, 1e-400, 1e400, 12345678901234567890.123]"), jessy::result::ok);
+		auto const array = *parser.root()->as_array();
+		auto it = array.begin();
+		REQUIRE_EQ(*it++->as_double(), 9.9);
+		REQUIRE_EQ(*it++->as_double(), 0.1);
+		REQUIRE_EQ(*it++->as_double(), 2.2250738585072011e-308);
+		REQUIRE_EQ(*it++->as_double(), 4e-324);
+		REQUIRE_EQ(*it++->as_double(), 1.7976931348623157e308);
+		REQUIRE_EQ(*it++->as_double(), 9007199254740992.0);
+		REQUIRE_FALSE(it++->as_double());
+		REQUIRE_FALSE(it++->as_double());
+		REQUIRE_EQ(*it++->as_double(), 12345678901234567890.123);
+	}
+	
+	
+	SCENARIO("decimal") {
+		auto opts = jessy::options{};
+		for(auto const decode: {false, true}) {
+			CAPTURE(decode);
+			opts.decode_numbers = decode;
+			auto parser = jessy::parser{opts};
+			REQUIRE_EQ(parser.parse("[9.9, 9.995, -1.005, 1e3, 1.5e-1, 0.0000001, 92233720368547758.07, -92233720368547758.08, 92233720368547758.08, 2.5, 42]"), jessy::result::ok);
+			auto const array = *parser.root()->as_array();
+			auto it = array.begin();
+			REQUIRE_EQ(*it->as_decimal(2), 990);
+			REQUIRE_EQ(*it->as_decimal(0, jessy::rounding::toward_zero), 9);
+			REQUIRE_EQ(*it->as_decimal(0), 10);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), 1000);
+			REQUIRE_EQ(*it->as_decimal(2, jessy::rounding::toward_zero), 999);
+			REQUIRE_FALSE(it->as_decimal(2, jessy::rounding::exact));
+			REQUIRE_EQ(*it->as_decimal(3, jessy::rounding::exact), 9995);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2, jessy::rounding::half_away_from_zero), -101);
+			REQUIRE_EQ(*it->as_decimal(2), -100);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), 100000);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), 15);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), 0);
+			REQUIRE_FALSE(it->as_decimal(2, jessy::rounding::exact));
+			REQUIRE_EQ(*it->as_decimal(7), 1);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), INT64_MAX);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(2), INT64_MIN);
+			++it;
+			REQUIRE_FALSE(it->as_decimal(2));
+			++it;
+			REQUIRE_EQ(*it->as_decimal(0), 2);
+			REQUIRE_EQ(*it->as_decimal(0, jessy::rounding::half_away_from_zero), 3);
+			++it;
+			REQUIRE_EQ(*it->as_decimal(4), 420000);
+		}
+	}
+	
+	
 	SCENARIO("string") {
 		auto parser = jessy::parser{};
         auto const parsed = parser.parse("\"ok\"");
@@ -72,6 +269,25 @@ TEST_SUITE("jessy") {
 		REQUIRE_EQ(*maybe_string, "ok");
     }
 	
+	SCENARIO("long strings") {
+		auto parser = jessy::parser{};
+		for(auto n = 0u; n != 100u; ++n) {
+			auto const body = std::string(n, 'x') + "\xD0\xB6";
+			auto const parsed = parser.parse("\"" + body + "\"");
+			REQUIRE_EQ(parsed, jessy::result::ok);
+			REQUIRE_EQ(*parser.root()->as_string(), body);
+		}
+	}
+	
+	
+	SCENARIO("unclosed long string") {
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse("\"" + std::string(70, 'x') + "\n\"");
+		REQUIRE_EQ(parsed, jessy::result::unclosed_string);
+		REQUIRE_EQ(parser.parse("\"" + std::string(40, 'x')), jessy::result::unclosed_string);
+	}
+	
+	
 	SCENARIO("string with escapes") {
 		auto parser = jessy::parser{};
         auto const parsed = parser.parse("\"ok\\r\\n\\b\\f\\u000D\\u000a\"");
@@ -82,6 +298,26 @@ TEST_SUITE("jessy") {
     }
 	
 	
+	SCENARIO("embedded json string") {
+		auto const inner = std::string{R"({"symbol":"EURUSD","comment":"long enough comment to span several vector blocks","ids":[1,2,3]})"};
+		auto escaped = std::string{};
+		for(auto const c: inner) {
+			if(c == '"')
+				escaped += '\\';
+			escaped += c;
+		}
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse("[\"" + escaped + "\", \"" + escaped + "\\u0021\"]");
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const maybe_array = parser.root()->as_array();
+		REQUIRE(maybe_array);
+		auto it = maybe_array->begin();
+		REQUIRE_EQ(*it->as_string(), inner);
+		++it;
+		REQUIRE_EQ(*it->as_string(), inner + "!");
+	}
+	
+	
 	SCENARIO("array") {
 		auto parser = jessy::parser{};
         auto const parsed = parser.parse("[1, 2, 3]");
@@ -129,6 +365,31 @@ TEST_SUITE("jessy") {
         auto const parsed = parser.parse(text);
 		REQUIRE_EQ(parsed, jessy::result::ok);
 	}
+
+	
+	SCENARIO("deep indentation") {
+		auto text = std::string{"{"};
+		for(auto i = 0; i != 100; ++i)
+			text += "\n" + std::string(std::size_t(i), i % 2 == 0 ? ' ' : '\t')
+				+ "\"k" + std::to_string(i) + "\"\r\n" + std::string(40, ' ') + ": " + std::to_string(i) + ",";
+		text += "\"last\" : true" + std::string(70, ' ') + "}" + std::string(33, ' ');
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse(text);
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const maybe_object = parser.root()->as_object();
+		REQUIRE(maybe_object);
+		REQUIRE_EQ(maybe_object->size(), 101);
+		auto const it = maybe_object->find(maybe_object->begin(), "k99");
+		REQUIRE_NE(it, maybe_object->end());
+		REQUIRE_EQ(*it->as_int(), 99);
+	}
+	
+	
+	SCENARIO("whitespace only") {
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse(std::string(100, ' '));
+		REQUIRE_EQ(parsed, jessy::result::incomplete_json);
+	}
 	
 	
 	SCENARIO("find field at end") {
@@ -142,6 +403,653 @@ TEST_SUITE("jessy") {
 		REQUIRE_NE(it, object.end());
     }
 
+	
+	SCENARIO("find escaped key") {
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(R"({"ab": 1, "ba": 2, "a\u0062c": 3, "long key with the same prefix 1": 4, "long key with the same prefix 2": 5})"),
+		           jessy::result::ok);
+		auto const object = *parser.root()->as_object();
+		REQUIRE_EQ(*object.find(object.begin(), "ba")->as_int(), 2);
+		REQUIRE_EQ(*object.find(object.begin(), "abc")->as_int(), 3);
+		REQUIRE_EQ(*object.find(object.begin(), "long key with the same prefix 2")->as_int(), 5);
+		REQUIRE_EQ(object.find(object.begin(), "a\\u0062c"), object.end());
+		REQUIRE_EQ(parser.parse(R"({"x": 1, "y)"), jessy::result::unclosed_string);
+	}
+
+
+	SCENARIO("key hash mixes every byte") {
+		auto hashes = std::vector<std::uint32_t>{};
+		for(auto i = 0; i != 100; ++i) {
+			auto key = "book_bid_level_" + std::to_string(100 + i) + "_quantity";
+			hashes.push_back(jessy::detail::key_hash(key));
+		}
+		std::sort(hashes.begin(), hashes.end());
+		REQUIRE_EQ(std::unique(hashes.begin(), hashes.end()), hashes.end());
+		static_assert(jessy::detail::key_hash("order_level_01_quantity") != jessy::detail::key_hash("order_level_02_quantity"));
+	}
+
+	
+	SCENARIO("find in wide object") {
+		auto text = std::string{"{\"nested\": {\"a\": [1, {\"b\": 2}]}"};
+		for(auto i = 0; i != 200; ++i)
+			text += ", \"field" + std::to_string(i) + "\": " + std::to_string(i);
+		text += ", \"field7\": -1}";
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(text), jessy::result::ok);
+		for(auto round = 0; round != 2; ++round) {
+			auto const object = *parser.root()->as_object();
+			for(auto i = 199; i >= 0; --i) {
+				auto const it = parser.find(object, "field" + std::to_string(i));
+				REQUIRE_NE(it, object.end());
+				REQUIRE_EQ(*it->as_int(), i);
+			}
+			REQUIRE_EQ(parser.find(object, "missing"), object.end());
+			auto const nested = parser.find(object, "nested");
+			REQUIRE_NE(nested, object.end());
+			REQUIRE_EQ(nested.key(), "nested");
+			auto const inner = *nested->as_object();
+			REQUIRE_NE(parser.find(inner, "a"), inner.end());
+		}
+	}
+	
+	
+	SCENARIO("find in many wide objects") {
+		auto text = std::string{"["};
+		for(auto i = 0; i != 40; ++i) {
+			text += i == 0 ? "{" : ", {";
+			for(auto j = 0; j != 20; ++j)
+				text += (j == 0 ? "\"f" : ", \"f") + std::to_string(j) + "\": " + std::to_string(i * 100 + j);
+			text += "}";
+		}
+		text += "]";
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(text), jessy::result::ok);
+		for(auto round = 0; round != 2; ++round) {
+			auto i = 0;
+			auto const array = *parser.root()->as_array();
+			for(auto const& each: array) {
+				auto const object = *each.as_object();
+				auto const it = parser.find(object, "f13");
+				REQUIRE_NE(it, object.end());
+				REQUIRE_EQ(*it->as_int(), i * 100 + 13);
+				++i;
+			}
+		}
+	}
+	
+	
+	SCENARIO("shape cache") {
+		auto opts = jessy::options{};
+		opts.cache_shapes = true;
+		auto parser = jessy::parser{opts};
+		auto price = jessy::field_ref{"price"};
+		auto const messages = {
+			R"({"symbol": "EURUSD", "price": 1.1, "qty": 1})",
+			R"({"symbol": "GBPUSD", "price": 1.2, "qty": 2})",
+			R"({"symbol": "USDJPY", "legs": [1, 2], "price": 1.3})",
+			R"({"symbol": "USDJPY", "legs": [1, 2, 3], "price": 1.4})",
+			R"({"price": 1.5, "symbol": "EURUSD", "qty": 1})",
+			R"({"symbol": "EURUSD", "qty": 1})"
+		};
+		auto expected = std::vector<double>{1.1, 1.2, 1.3, 1.4, 1.5};
+		auto shapes = std::vector<std::size_t>{};
+		auto i = std::size_t(0);
+		for(auto const* message: messages) {
+			REQUIRE_EQ(parser.parse(message), jessy::result::ok);
+			auto const object = *parser.root()->as_object();
+			shapes.push_back(object.shape());
+			auto const it = price.find(object);
+			if(i < expected.size()) {
+				REQUIRE_NE(it, object.end());
+				REQUIRE_EQ(*it->as_double(), expected[i]);
+			} else {
+				REQUIRE_EQ(it, object.end());
+			}
+			++i;
+		}
+		if constexpr(jessy::value_tag::aux_bits != 0) {
+			REQUIRE_NE(shapes[0], 0);
+			REQUIRE_EQ(shapes[0], shapes[1]);
+			REQUIRE_EQ(shapes[2], shapes[3]);
+			REQUIRE_NE(shapes[0], shapes[2]);
+			REQUIRE_NE(shapes[0], shapes[4]);
+		}
+	}
+
+
+	SCENARIO("shape cache is bounded") {
+		auto opts = jessy::options{};
+		opts.cache_shapes = true;
+		opts.max_shapes = 4;
+		auto parser = jessy::parser{opts};
+		auto id = jessy::field_ref{"id"};
+		auto shapes = std::vector<std::size_t>{};
+		for(auto i = 0; i != 20; ++i) {
+			auto const message = "{\"id\": " + std::to_string(i) + ", \"key" + std::to_string(i) + "\": 0}";
+			REQUIRE_EQ(parser.parse(message), jessy::result::ok);
+			auto const object = *parser.root()->as_object();
+			shapes.push_back(object.shape());
+			REQUIRE_EQ(*id.find(object)->as_int(), i);
+		}
+		if constexpr(jessy::value_tag::aux_bits != 0) {
+			std::sort(shapes.begin(), shapes.end());
+			REQUIRE_NE(shapes.front(), 0);
+			REQUIRE_EQ(std::unique(shapes.begin(), shapes.end()), shapes.end());
+		}
+	}
+	
+	
+	SCENARIO("dispatch keys") {
+		static constexpr std::string_view keys[] = {"symbol", "price", "qty", "side"};
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(R"({"qty": 3, "extra": {"price": 0}, "price": 1.5, "symbol": "EURUSD"})"),
+		           jessy::result::ok);
+		auto symbol = std::string_view{};
+		auto price = 0.0;
+		auto qty = std::int64_t(0);
+		auto side = false;
+		auto const dispatched = jessy::dispatch<keys>(*parser.root()->as_object(),
+			[&](jessy::value const& v) { symbol = *v.as_string(); },
+			[&](jessy::value const& v) { price = *v.as_double(); },
+			[&](jessy::value const& v) { qty = *v.as_int(); },
+			[&](jessy::value const&) { side = true; });
+		REQUIRE_EQ(dispatched, 3);
+		REQUIRE_EQ(symbol, "EURUSD");
+		REQUIRE_EQ(price, 1.5);
+		REQUIRE_EQ(qty, 3);
+		REQUIRE_FALSE(side);
+	}
+	
+	
+	SCENARIO("dispatch duplicated keys") {
+		static constexpr std::string_view keys[] = {"a", "b", "a"};
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(R"({"a": 1, "b": 2, "c": 3})"), jessy::result::ok);
+		auto calls = std::vector<int>{};
+		auto const dispatched = jessy::dispatch<keys>(*parser.root()->as_object(),
+			[&](jessy::value const&) { calls.push_back(0); },
+			[&](jessy::value const&) { calls.push_back(1); },
+			[&](jessy::value const&) { calls.push_back(2); });
+		REQUIRE_EQ(dispatched, 2);
+		REQUIRE_EQ(calls, std::vector<int>{0, 1});
+	}
+	
+	
+	SCENARIO("dispatch wide key sets") {
+		static constexpr std::string_view keys[] = {
+			"account", "clOrdId", "origClOrdId", "orderId", "execId", "symbol", "securityId", "side",
+			"price", "stopPrice", "orderQty", "cumQty", "leavesQty", "lastQty", "lastPx", "avgPx",
+			"ordType", "ordStatus", "execType", "timeInForce", "transactTime", "sendingTime", "currency", "exchange",
+			"text", "minQty", "maxFloor", "expireTime", "settlDate", "tradeDate", "commission", "commType",
+			"handlInst", "execInst", "positionEffect", "maturityDate", "strikePrice", "putOrCall", "multiplier", "rule80A",
+			"capacity", "partyId", "partyRole", "venue", "strategy", "parentId", "rootId", "sequence",
+			"version", "timestamp"};
+		static_assert(std::size(keys) == 50);
+		REQUIRE(jessy::detail::make_perfect_hash(keys).found);
+		for(auto i = std::size_t(0); i != std::size(keys); ++i)
+			REQUIRE_EQ(jessy::dispatcher<keys>::index_of(keys[i]), i);
+		REQUIRE_EQ(jessy::dispatcher<keys>::index_of("quantity"), std::size(keys));
+		REQUIRE_EQ(jessy::dispatcher<keys>::index_of("pric"), std::size(keys));
+	}
+	
+	
+	SCENARIO("read struct") {
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(R"({"legs": [{"symbol": "EURUSD", "ratio": 1}, {"ratio": -0.5, "symbol": "GBPUSD"}],
+			"venue": 2, "side": "sell", "qty": -7, "price": 1.25, "symbol": "SPREAD", "id": 1700000000123,
+			"unknown": {"id": 1}, "active": true})"), jessy::result::ok);
+		auto o = order{};
+		o.comment = "stale";
+		REQUIRE_EQ(jessy::read(*parser.root(), o), jessy::result::ok);
+		REQUIRE_EQ(o.id, 1700000000123u);
+		REQUIRE_EQ(o.symbol, "SPREAD");
+		REQUIRE_EQ(o.price, 1.25);
+		REQUIRE_EQ(o.qty, -7);
+		REQUIRE_EQ(o.direction, side::sell);
+		REQUIRE_EQ(o.where, venue::cme);
+		REQUIRE(o.active);
+		REQUIRE_FALSE(o.comment);
+		REQUIRE_EQ(o.legs.size(), 2);
+		REQUIRE_EQ(o.legs[1].symbol, "GBPUSD");
+		REQUIRE_EQ(o.legs[1].ratio, -0.5);
+	}
+	
+	
+	SCENARIO("read struct errors") {
+		auto parser = jessy::parser{};
+		auto o = order{};
+		REQUIRE_EQ(parser.parse(R"({"id": 1, "symbol": "X", "price": 1, "qty": 1, "side": "buy", "venue": 1, "legs": [], "comment": null})"),
+		           jessy::result::ok);
+		REQUIRE_EQ(jessy::read(*parser.root(), o), jessy::result::missing_field);
+		REQUIRE_FALSE(o.comment);
+		REQUIRE_EQ(parser.parse(R"({"id": 1, "symbol": "X", "price": 1, "qty": 1, "side": "hold", "venue": 1, "legs": [], "active": false})"),
+		           jessy::result::ok);
+		REQUIRE_EQ(jessy::read(*parser.root(), o), jessy::result::type_mismatch);
+		REQUIRE_EQ(parser.parse(R"({"id": 1, "symbol": "X", "price": 1, "qty": 3000000000, "side": "buy", "venue": 1, "legs": [], "active": false})"),
+		           jessy::result::ok);
+		REQUIRE_EQ(jessy::read(*parser.root(), o), jessy::result::number_is_out_of_range);
+		REQUIRE_EQ(parser.parse("[]"), jessy::result::ok);
+		REQUIRE_EQ(jessy::read(*parser.root(), o), jessy::result::type_mismatch);
+	}
+	
+	
+	SCENARIO("parse into struct") {
+		auto parser = jessy::parser{};
+		auto o = order{};
+		o.comment = "stale";
+		auto const parsed = parser.parse_into(R"({"id": 1700000000123, "symbol": "SPREAD", "price": 1.25,
+			"qty": -7, "side": "sell", "venue": 2,
+			"legs": [{"symbol": "EUR\u0055SD", "ratio": 1}, {"ratio": -0.5, "symbol": "GBPUSD"}],
+			"unknown": {"id": [1, "}", {"x": null}], "s": "a\"b"}, "active": true})", o);
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		REQUIRE_EQ(o.id, 1700000000123u);
+		REQUIRE_EQ(o.symbol, "SPREAD");
+		REQUIRE_EQ(o.price, 1.25);
+		REQUIRE_EQ(o.qty, -7);
+		REQUIRE_EQ(o.direction, side::sell);
+		REQUIRE_EQ(o.where, venue::cme);
+		REQUIRE(o.active);
+		REQUIRE_FALSE(o.comment);
+		REQUIRE_EQ(o.legs.size(), 2);
+		REQUIRE_EQ(o.legs[0].symbol, "EURUSD");
+		REQUIRE_EQ(o.legs[1].symbol, "GBPUSD");
+		REQUIRE_EQ(o.legs[1].ratio, -0.5);
+		REQUIRE(parser.root()->is_null());
+	}
+	
+	
+	SCENARIO("parse into struct errors") {
+		auto parser = jessy::parser{};
+		auto o = order{};
+		REQUIRE_EQ(parser.parse_into(R"({"id": 1, "symbol": "X", "price": 1, "qty": 1, "side": "buy", "venue": 1, "legs": []})", o),
+		           jessy::result::missing_field);
+		REQUIRE_EQ(parser.parse_into(R"({"id": 1.5})", o), jessy::result::type_mismatch);
+		REQUIRE_EQ(parser.parse_into(R"({"id": "1"})", o), jessy::result::type_mismatch);
+		REQUIRE_EQ(parser.parse_into(R"({"side": "hold"})", o), jessy::result::type_mismatch);
+		REQUIRE_EQ(parser.parse_into(R"({"qty": 3000000000})", o), jessy::result::number_is_out_of_range);
+		REQUIRE_EQ(parser.parse_into(R"({"id": -1})", o), jessy::result::number_is_out_of_range);
+		REQUIRE_EQ(parser.parse_into(R"({"unknown": [1, 2)", o), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse_into(R"({"unknown": )", o), jessy::result::incomplete_json);
+		REQUIRE_EQ(parser.parse_into(R"({"unknown": "\x"})", o), jessy::result::invalid_escape_sequence);
+		REQUIRE_EQ(parser.parse_into(R"({"unknown": nil})", o), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse_into(R"({"id": 1 "symbol": "X"})", o), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse_into("[]", o), jessy::result::type_mismatch);
+		REQUIRE_EQ(parser.parse_into("", o), jessy::result::incomplete_json);
+		REQUIRE_EQ(parser.parse_into("{\"x\": \xC3\xA9, \"a\": 1}", o), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse_into("{\"id\": \xC3}", o), jessy::result::illformed_json);
+	}
+	
+	
+	SCENARIO("parse projection") {
+		auto parser = jessy::parser{};
+		auto const wanted = jessy::projection{"/id", "/legs/symbol", "/meta", "/a~1b"};
+		auto const parsed = parser.parse(R"({"id": 1, "name": "x", "legs": [{"symbol": "A", "ratio": 1},
+			{"ratio": 2, "symbol": "B", "extra": [1, {"symbol": 0}]}], "meta": {"x": [1, 2]},
+			"skipped": {"id": [true, false, null, "\u0041"]}, "a/b": 3})", wanted);
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const object = *parser.root()->as_object();
+		REQUIRE_EQ(object.size(), 4);
+		REQUIRE_EQ(*object.find(object.begin(), "id")->as_int(), 1);
+		REQUIRE_EQ(object.find(object.begin(), "name"), object.end());
+		REQUIRE_EQ(object.find(object.begin(), "skipped"), object.end());
+		REQUIRE_EQ(*object.find(object.begin(), "a/b")->as_int(), 3);
+		auto const legs = *object.find(object.begin(), "legs")->as_array();
+		REQUIRE_EQ(legs.size(), 2);
+		auto leg = legs.begin();
+		++leg;
+		auto const second = *leg->as_object();
+		REQUIRE_EQ(second.size(), 1);
+		REQUIRE_EQ(*second.find(second.begin(), "symbol")->as_string(), "B");
+		auto const meta = *object.find(object.begin(), "meta")->as_object();
+		REQUIRE_EQ(meta.find(meta.begin(), "x")->as_array()->size(), 2);
+		REQUIRE_EQ(parser.parse(R"({"id": 1, "name": [1, 2 3]})", wanted), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse(R"({"id": 1, "name": "\q"})", wanted), jessy::result::invalid_escape_sequence);
+		REQUIRE_EQ(parser.parse(R"({"name": 1, "id": 2})", jessy::projection{""}), jessy::result::ok);
+		REQUIRE_EQ(parser.root()->as_object()->size(), 2);
+		REQUIRE_EQ(parser.parse("{\"x\": \xC3\xA9, \"id\": 1}", wanted), jessy::result::illformed_json);
+		REQUIRE_EQ(parser.parse("{\"x\": [\xFF], \"id\": 1}", wanted), jessy::result::illformed_json);
+	}
+	
+	
+	SCENARIO("validate") {
+		auto const texts = {
+			"", "null", "nul", "true", "tru", "false", "fals", "-", "-1", "1.5e3", "1.", "1e", "--1",
+			"\"a\\u00e9\\n\"", "\"a", "\"a\nb\"", "\"\\u00g0\"", "\"\\x\"",
+			"[]", "[1, 2]", "[1 2]", "[1,]", "[1,", "{}", "{\"a\": 1}", "{\"a\" 1}", "{\"a\": 1,}",
+			"{\"a\": [1, {\"b\": null}], \"c\": \"d\"}", "{1: 2}", "{\"a\": ", "{\"a", "x",
+			"\xC3\xA9", "[\x80]", "{\"a\": \xFF}", "\"\xC3\xA9\""
+		};
+		auto parser = jessy::parser{};
+		auto validator = jessy::parser{};
+		for(auto const text: texts) {
+			CAPTURE(text);
+			REQUIRE_EQ(validator.validate(text), parser.parse(text));
+			REQUIRE(validator.root()->is_null());
+		}
+		char text[16 + jessy::parser::padding] = "{\"a\": \"\\t\"}";
+		REQUIRE_EQ(validator.validate_in_place(text, 11), jessy::result::ok);
+		REQUIRE_EQ(std::string_view{text}, "{\"a\": \"\\t\"}");
+	}
+	
+	
+	SCENARIO("kernels agree on every supported simd level") {
+		using jessy::detail::simd_level;
+		auto text = std::string{R"({ "a" : "x\\\"y" ,   "b":[1, tr , "\u0041"],)"};
+		text += std::string(70, ' ') + "\"" + std::string(90, 'z') + "\\\\\" \t\r\n: 1}";
+		auto const size = text.size();
+		text.append(jessy::parser::padding, '\0');
+		auto const reference = jessy::detail::kernels_for(simd_level::scalar);
+		auto const top = jessy::detail::detect_simd_level();
+		for(auto level = simd_level::sse2; level <= top; level = simd_level(int(level) + 1)) {
+			CAPTURE(int(level));
+			auto const tested = jessy::detail::kernels_for(level);
+			for(auto i = std::size_t(0); i != size; ++i) {
+				REQUIRE_EQ(tested.count_whitespace(&text[i]), reference.count_whitespace(&text[i]));
+				REQUIRE_EQ(tested.count_plain(&text[i]), reference.count_plain(&text[i]));
+				auto copied = std::string(size + 1, '-');
+				auto const n = tested.copy_plain(copied.data(), &text[i]);
+				REQUIRE_EQ(n, reference.count_plain(&text[i]));
+				REQUIRE_EQ(copied.compare(0, n, text, i, n), 0);
+			}
+		}
+	}
+	
+	
+	SCENARIO("max depth") {
+		auto opts = jessy::options{};
+		opts.max_depth = 3;
+		auto parser = jessy::parser{opts};
+		REQUIRE_EQ(parser.parse(R"([{"a": [1]}, []])"), jessy::result::ok);
+		REQUIRE_EQ(parser.parse(R"([{"a": [[1]]}])"), jessy::result::depth_exceeded);
+		REQUIRE_EQ(parser.validate(R"([{"a": [1]}, []])"), jessy::result::ok);
+		REQUIRE_EQ(parser.validate(R"([{"a": [[1]]}])"), jessy::result::depth_exceeded);
+		REQUIRE_EQ(parser.parse(R"([{"a": [[1]]}])", jessy::projection{"/b"}), jessy::result::depth_exceeded);
+		auto const deep = std::string(100000, '[') + std::string(100000, ']');
+		REQUIRE_EQ(jessy::parser{}.parse(deep), jessy::result::depth_exceeded);
+		opts.max_depth = 100000;
+		auto deep_parser = jessy::parser{opts};
+		REQUIRE_EQ(deep_parser.parse(deep), jessy::result::ok);
+		REQUIRE_EQ(deep_parser.root()->as_array()->size(), 1);
+		REQUIRE_EQ(deep_parser.validate(deep), jessy::result::ok);
+	}
+	
+	
+	SCENARIO("compact document") {
+		auto const text = std::string{R"({"id": 12, "price": 1.25, "big": 18446744073709551615, "name": "a\tb",
+			"flags": [true, false, null], "nested": {"x": [], "y": {}}, "last": -3})"};
+		auto parser = jessy::parser{};
+		auto document = jessy::compact_document{};
+		auto in_place = text;
+		in_place.append(jessy::parser::padding, '\0');
+		for(auto const borrowed: {false, true}) {
+			auto const parsed = borrowed ? parser.parse_in_place(in_place.data(), text.size(), document)
+			                             : parser.parse(text, document);
+			REQUIRE_EQ(parsed, jessy::result::ok);
+			REQUIRE_EQ(document.size(), 22);
+			auto const object = *document.root().as_object();
+			REQUIRE_EQ(object.size(), 7);
+			REQUIRE_EQ(*(*object.find(object.begin(), "id")).as_int(), 12);
+			REQUIRE_EQ(*(*object.find(object.begin(), "price")).as_double(), 1.25);
+			REQUIRE_EQ(*(*object.find(object.begin(), "price")).as_decimal(2), 125);
+			REQUIRE((*object.find(object.begin(), "price")).is_float());
+			REQUIRE_FALSE((*object.find(object.begin(), "price")).as_int());
+			REQUIRE_EQ(*(*object.find(object.begin(), "big")).as_uint(), UINT64_MAX);
+			REQUIRE_FALSE((*object.find(object.begin(), "big")).as_int());
+			REQUIRE_EQ(*(*object.find(object.begin(), "name")).as_string(), "a\tb");
+			REQUIRE_EQ(*(*object.find(object.begin(), "last")).as_int(), -3);
+			REQUIRE_EQ(object.find(object.begin(), "missing"), object.end());
+			auto const flags = *(*object.find(object.begin(), "flags")).as_array();
+			REQUIRE_EQ(flags.size(), 3);
+			auto it = flags.begin();
+			REQUIRE(*(*it++).as_bool());
+			REQUIRE_FALSE(*(*it++).as_bool());
+			REQUIRE((*it++).is_null());
+			REQUIRE_EQ(it, flags.end());
+			auto const nested = *(*object.find(object.begin(), "nested")).as_object();
+			auto keys = std::string{};
+			for(auto each = nested.begin(); each != nested.end(); ++each)
+				keys += each.key();
+			REQUIRE_EQ(keys, "xy");
+			REQUIRE((*nested.begin()).as_array()->empty());
+		}
+		auto moved = std::move(document);
+		REQUIRE_EQ(*(*moved.root().as_object()->begin()).as_int(), 12);
+		REQUIRE(jessy::compact_document{}.root().is_null());
+		
+		for(auto const* invalid: {"", "[1,", "{\"a\" 1}", "[1 2]", "{\"a\":}", "-x", "tru"}) {
+			auto const expected = parser.parse(invalid);
+			REQUIRE_NE(expected, jessy::result::ok);
+			REQUIRE_EQ(parser.parse(invalid, document), expected);
+		}
+		auto opts = jessy::options{};
+		opts.max_depth = 2;
+		auto shallow = jessy::parser{opts};
+		REQUIRE_EQ(shallow.parse("[[[]]]", document), jessy::result::depth_exceeded);
+	}
+	
+	
+	SCENARIO("copied and moved parser keeps values") {
+		auto const text = std::string{R"({"name": "a\tb", "price": 1.5, "tags": ["x", "y"]})"};
+		auto check = [](jessy::parser const& parser) {
+			auto const object = *parser.root()->as_object();
+			REQUIRE_EQ(*object.find(object.begin(), "name")->as_string(), "a\tb");
+			REQUIRE_EQ(*object.find(object.begin(), "price")->as_double(), 1.5);
+			auto const tags = *object.find(object.begin(), "tags")->as_array();
+			REQUIRE_EQ(*tags.begin()->as_string(), "x");
+		};
+		auto copy = jessy::parser{};
+		auto moved = jessy::parser{};
+		{
+			auto original = jessy::parser{};
+			REQUIRE_EQ(original.parse(text), jessy::result::ok);
+			auto constructed = original;
+			copy = original;
+			auto const* name = original.root()->as_object()->begin()->as_string()->data();
+			REQUIRE_NE(copy.root()->as_object()->begin()->as_string()->data(), name);
+			moved = std::move(constructed);
+			original.parse("[]");
+		}
+		check(copy);
+		check(moved);
+		auto const again = jessy::parser{std::move(moved)};
+		check(again);
+		char data[128 + jessy::parser::padding];
+		text.copy(data, text.size());
+		auto in_place = jessy::parser{};
+		REQUIRE_EQ(in_place.parse_in_place(data, text.size()), jessy::result::ok);
+		auto const copied = in_place;
+		REQUIRE_EQ(copied.root()->as_object()->begin()->as_string()->data(), data + 10);
+	}
+	
+	
+	SCENARIO("detached documents") {
+		auto pool = jessy::document_pool{};
+		auto parser = jessy::parser{};
+		auto first = pool.acquire();
+		REQUIRE_EQ(parser.parse(R"({"name": "first"})", first), jessy::result::ok);
+		auto second = pool.acquire();
+		REQUIRE_EQ(parser.parse(R"(["second", 2])", second), jessy::result::ok);
+		REQUIRE(parser.root()->is_null());
+		auto const moved = std::move(first);
+		REQUIRE_EQ(*moved.root()->as_object()->begin()->as_string(), "first");
+		REQUIRE_EQ(*second.root()->as_array()->begin()->as_string(), "second");
+		auto const* storage = second.root();
+		pool.release(std::move(second));
+		REQUIRE_EQ(pool.size(), 1);
+		auto recycled = pool.acquire();
+		REQUIRE(recycled.empty());
+		REQUIRE_EQ(parser.parse(R"(["third"])"), jessy::result::ok);
+		parser.detach(recycled);
+		REQUIRE_EQ(*recycled.root()->as_array()->begin()->as_string(), "third");
+		REQUIRE_EQ(parser.parse("[]"), jessy::result::ok);
+		REQUIRE_EQ(parser.root(), storage);
+		auto const copy = recycled;
+		recycled.clear();
+		REQUIRE_EQ(*copy.root()->as_array()->begin()->as_string(), "third");
+		
+		auto caller = std::string{R"({"name": "in place", "id": 7})"};
+		auto const size = caller.size();
+		caller.append(jessy::parser::padding, '\0');
+		REQUIRE_EQ(parser.parse_in_place(caller.data(), size), jessy::result::ok);
+		parser.detach(recycled);
+		auto values = std::vector<jessy::value>(8);
+		auto chars = std::vector<char>(size + jessy::parser::padding);
+		auto span = jessy::document{};
+		REQUIRE_EQ(parser.parse(R"(["span", 1.5])", values.data(), values.size(), chars.data(), chars.size()),
+		           jessy::result::ok);
+		parser.detach(span);
+		std::fill(caller.begin(), caller.end(), 'x');
+		std::fill(chars.begin(), chars.end(), 'x');
+		auto member = recycled.root()->as_object()->begin();
+		REQUIRE_EQ(member.key(), "name");
+		REQUIRE_EQ(*member->as_string(), "in place");
+		++member;
+		REQUIRE_EQ(member.key(), "id");
+		REQUIRE_EQ(*member->as_int(), 7);
+		auto element = span.root()->as_array()->begin();
+		REQUIRE_EQ(*element->as_string(), "span");
+		++element;
+		REQUIRE_EQ(*element->as_double(), 1.5);
+	}
+	
+	
+#if JESSY_PMR
+	SCENARIO("parser storage from memory resource") {
+		static char arena[256 * 1024];
+		auto resource = std::pmr::monotonic_buffer_resource{arena, sizeof(arena), std::pmr::null_memory_resource()};
+		auto opts = jessy::options{};
+		opts.cache_shapes = true;
+		auto parser = jessy::parser{&resource, opts};
+		REQUIRE_EQ(parser.resource(), &resource);
+		auto text = std::string{"["};
+		for(auto i = 0; i != 20; ++i)
+			text += R"({"a": 1, "b": "x", "c": [true, null]},)";
+		text += "{}]";
+		for(auto i = 0; i != 100; ++i)
+			REQUIRE_EQ(parser.parse(text), jessy::result::ok);
+		REQUIRE_EQ(parser.root()->as_array()->size(), 21);
+		auto document = jessy::document{&resource};
+		REQUIRE_EQ(parser.parse(text, document), jessy::result::ok);
+		REQUIRE_EQ(document.resource(), &resource);
+		auto elsewhere = jessy::document{};
+		REQUIRE_EQ(parser.parse(R"(["other"])", elsewhere), jessy::result::ok);
+		REQUIRE_EQ(elsewhere.resource(), std::pmr::get_default_resource());
+		REQUIRE_EQ(*elsewhere.root()->as_array()->begin()->as_string(), "other");
+		auto moved = std::move(document);
+		REQUIRE_EQ(moved.resource(), &resource);
+		REQUIRE_EQ(moved.root()->as_array()->size(), 21);
+		auto pool = jessy::document_pool{&resource};
+		REQUIRE_EQ(pool.acquire().resource(), &resource);
+		auto compact = jessy::compact_document{&resource};
+		REQUIRE_EQ(parser.parse(text, compact), jessy::result::ok);
+		REQUIRE_EQ(compact.resource(), &resource);
+		REQUIRE_EQ(compact.root().as_array()->size(), 21);
+		auto wanted = jessy::projection{&resource};
+		wanted.add("/a").add("/c");
+		REQUIRE_EQ(parser.parse(R"({"a": 1, "b": "x", "c": [true]})", wanted), jessy::result::ok);
+		REQUIRE_EQ(parser.root()->as_object()->size(), 2);
+	}
+#endif
+	
+	
+#if JESSY_PMR
+	SCENARIO("parse into caller spans does not grow shape table") {
+		struct counting_resource: std::pmr::memory_resource {
+			std::size_t allocations{0};
+			
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+				++allocations;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+			
+			void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+				std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+			}
+			
+			bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+				return this == &other;
+			}
+		} resource;
+		auto text = std::string{"["};
+		for(auto i = 0; i != 100; ++i)
+			text += "{\"k" + std::to_string(i) + "\": " + std::to_string(i) + "},";
+		text += "{}]";
+		auto values = std::vector<jessy::value>(512);
+		auto chars = std::vector<char>(text.size() + jessy::parser::padding);
+		auto opts = jessy::options{};
+		opts.cache_shapes = true;
+		for(auto const warm: {false, true}) {
+			auto parser = jessy::parser{&resource, opts};
+			REQUIRE_EQ(parser.parse("[]", values.data(), values.size(), chars.data(), chars.size()),
+			           jessy::result::ok);
+			if(warm)
+				REQUIRE_EQ(parser.parse(R"([{"a": 1}, {"b": 2}])"), jessy::result::ok);
+			auto const allocations = resource.allocations;
+			REQUIRE_EQ(parser.parse(text, values.data(), values.size(), chars.data(), chars.size()),
+			           jessy::result::ok);
+			REQUIRE_EQ(resource.allocations, allocations);
+			auto last = jessy::field_ref{"k99"};
+			auto found = 0;
+			auto shaped = 0;
+			auto const objects = *parser.root()->as_array();
+			for(auto const& each: objects) {
+				auto const object = *each.as_object();
+				found += last.find(object) != object.end();
+				shaped += object.shape() != 0;
+			}
+			REQUIRE_EQ(found, 1);
+			if constexpr(jessy::value_tag::aux_bits != 0)
+				REQUIRE_EQ(shaped != 0, warm);
+		}
+	}
+#endif
+	
+	
+	SCENARIO("parse into caller spans") {
+		auto const text = std::string_view{R"({"a": [1, "x", true], "b": null})"};
+		jessy::value values[8];
+		char chars[64 + jessy::parser::padding];
+		auto parser = jessy::parser{};
+		REQUIRE_EQ(parser.parse(text, values, 8, chars, sizeof(chars)), jessy::result::ok);
+		REQUIRE_EQ(parser.root(), &values[0]);
+		auto const object = parser.root()->as_object();
+		REQUIRE(object);
+		REQUIRE_EQ(object->size(), 2);
+		auto const array = object->begin()->as_array();
+		REQUIRE(array);
+		auto second = array->begin();
+		++second;
+		REQUIRE_EQ(*second->as_string(), "x");
+		REQUIRE_EQ(second->as_string()->data(), chars + 11);
+		auto const copy = parser;
+		REQUIRE_NE(copy.root(), &values[0]);
+		REQUIRE_EQ(copy.root()->as_object()->size(), 2);
+		REQUIRE_EQ(parser.parse(text, values, 7, chars, sizeof(chars)),
+		           jessy::result::capacity_exceeded);
+		REQUIRE_EQ(parser.parse(text, values, 8, chars, text.size() + jessy::parser::padding - 1),
+		           jessy::result::capacity_exceeded);
+		REQUIRE_EQ(parser.parse(text, values, 8, chars, 0), jessy::result::capacity_exceeded);
+		REQUIRE_EQ(parser.parse(text), jessy::result::ok);
+		REQUIRE_NE(parser.root(), &values[0]);
+		REQUIRE_EQ(parser.root()->as_object()->size(), 2);
+	}
+	
+	
+	SCENARIO("parse in place") {
+		char text[64 + jessy::parser::padding] = "{\"x\": \"a\\tb\"}";
+		auto const size = std::char_traits<char>::length(text);
+		auto parser = jessy::parser{};
+		auto const parsed = parser.parse_in_place(text, size);
+		REQUIRE_EQ(parsed, jessy::result::ok);
+		auto const maybe_object = parser.root()->as_object();
+		REQUIRE(maybe_object);
+		auto const maybe_string = maybe_object->begin()->as_string();
+		REQUIRE(maybe_string);
+		REQUIRE_EQ(*maybe_string, "a\tb");
+		REQUIRE_GE(maybe_string->data(), text);
+		REQUIRE_LT(maybe_string->data(), text + size);
+	}
+
 
 }
 